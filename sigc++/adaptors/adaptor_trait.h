@@ -107,6 +107,12 @@ struct adaptor_functor : public adaptor_base
    */
   explicit adaptor_functor(const T_functor& functor) : functor_(functor) {}
 
+  /** Constructs an adaptor_functor object that wraps the passed functor,
+   * moving it.
+   * @param functor Functor to invoke from operator()().
+   */
+  explicit adaptor_functor(T_functor&& functor) : functor_(std::move(functor)) {}
+
   /** Constructs an adaptor_functor object that wraps the passed (member)
    * function pointer.
    * @param type Pointer to function or class method to invoke from operator()().
@@ -25,6 +25,8 @@
 #include <sigc++/functors/ptr_fun.h>
 #include <sigc++/functors/mem_fun.h>
 #include <sigc++/adaptors/adaptor_trait.h>
+#include <cstddef>
+#include <utility>
 
 namespace sigc
 {
@@ -107,5 +109,36 @@ public:
   mutable adaptor_type functor_;
 };
 
+namespace internal
+{
+
+/** Calls a functor with its arguments rotated left by @e I_count positions.
+ * For instance, rotate_and_call<2>::call(f, a, b, c, d) calls f(c, d, a, b).
+ * The arguments are forwarded, so no copies are made. bind() and hide()
+ * use this to insert or remove arguments at some position.
+ */
+template <std::size_t I_count>
+struct rotate_and_call
+{
+  template <typename T_functor, typename T_first, typename... T_rest>
+  static decltype(auto) call(T_functor&& functor, T_first&& first, T_rest&&... rest)
+  {
+    return rotate_and_call<I_count - 1>::call(std::forward<T_functor>(functor),
+      std::forward<T_rest>(rest)..., std::forward<T_first>(first));
+  }
+};
+
+template <>
+struct rotate_and_call<0>
+{
+  template <typename T_functor, typename... T_arg>
+  static decltype(auto) call(T_functor&& functor, T_arg&&... arg)
+  {
+    return std::forward<T_functor>(functor)(std::forward<T_arg>(arg)...);
+  }
+};
+
+} /* namespace internal */
+
 } /* namespace sigc */
 #endif /* SIGC_ADAPTORS_ADAPTS_H */
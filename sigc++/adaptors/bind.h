@@ -21,11 +21,10 @@
 
 #include <sigc++/adaptors/adapts.h>
 #include <sigc++/adaptors/bound_argument.h>
+#include <sigc++/reference_wrapper.h>
+#include <functional>
 #include <sigc++/adaptors/tuple_visitor_visit_each.h>
 #include <sigc++/tuple-utils/tuple_for_each.h>
-#include <sigc++/tuple-utils/tuple_start.h>
-#include <sigc++/tuple-utils/tuple_end.h>
-#include <sigc++/tuple-utils/tuple_transform_each.h>
 
 
 namespace sigc
@@ -54,6 +53,13 @@ namespace sigc
  * sigc::bind(&foo,1,2,3)();    //fixes all three arguments and calls foo(1,2,3)
  * @endcode
  *
+ * Nested bind() and hide() calls are fused at compile time, so that
+ * the stacked adaptors don't add layers to the functor that is called:
+ * - sigc::bind<N>(sigc::bind<N>(&foo, 1), 2) gives one sigc::bind_functor
+ *   with both bound arguments.
+ * - sigc::bind<N>(sigc::hide<N>(&foo), 1) gives the functor that
+ *   sigc::hide() wraps, because the bound argument would be ignored.
+ *
  * The functor sigc::bind() returns can be passed into
  * sigc::signal::connect() directly.
  *
@@ -100,18 +106,8 @@ namespace sigc
  * @ingroup adaptors
  */
 
-namespace internal
-{
-
-template <typename T_element>
-struct TransformEachInvoker
-{
-  // We take T_element as non-const because invoke() is not const.
-  // TODO: Take element as T_element&& ?
-  constexpr static decltype(auto) transform(T_element& element) { return element.invoke(); }
-};
-
-} // namespace internal
+template <int I_location, typename T_functor>
+struct hide_functor;
 
 /** Adaptor that binds arguments to the wrapped functor.
  * Use the convenience function sigc::bind() to create an instance of sigc::bind_functor.
@@ -134,44 +130,41 @@ struct bind_functor : public adapts<T_functor>
   template <typename... T_arg>
   decltype(auto) operator()(T_arg&&... arg)
   {
-    // For instance, if I_location is 1, and arg has 4 arguments,
-    // we would want to call operator() with (arg0, bound, arg1, arg2).
-
-    using tuple_type_args = std::tuple<type_trait_pass_t<T_arg>...>;
-    const auto t_args = std::tuple<T_arg...>(std::forward<T_arg>(arg)...);
-    constexpr auto t_args_size = std::tuple_size<tuple_type_args>::value;
-
-    // Prevent calling tuple_start<> with values that will cause a compilation error.
-    static_assert(I_location <= t_args_size,
+    static_assert(I_location <= sizeof...(T_arg),
       "I_location must be less than or equal to the number of arguments.");
 
-    const auto t_start = internal::tuple_start<I_location>(t_args);
-    const auto t_bound = internal::tuple_transform_each<internal::TransformEachInvoker>(bound_);
-    const auto t_end = internal::tuple_end<t_args_size - I_location>(t_args);
-    const auto t_with_bound = std::tuple_cat(t_start, t_bound, t_end);
-
-    constexpr const auto seq =
-      std::make_index_sequence<std::tuple_size<decltype(t_with_bound)>::value>();
-    return call_functor_operator_parentheses(t_with_bound, seq);
+    return call_with_bound(
+      std::index_sequence_for<T_bound...>(), std::forward<T_arg>(arg)...);
   }
 
   /** Constructs a bind_functor object that binds an argument to the passed functor.
+   * The bound arguments are constructed in place from @e bound, moving rvalues.
    * @param func Functor to invoke from operator()().
    * @param bound Argument to bind to the functor.
    */
-  bind_functor(type_trait_take_t<T_functor> func, type_trait_take_t<T_bound>... bound)
-  : adapts<T_functor>(func), bound_(bound...)
+  template <typename... T_arg,
+    typename = std::enable_if_t<sizeof...(T_arg) == sizeof...(T_bound)>>
+  bind_functor(type_trait_take_t<T_functor> func, T_arg&&... bound)
+  : adapts<T_functor>(func), bound_(std::forward<T_arg>(bound)...)
   {
   }
 
-private:
   /// The arguments bound to the functor.
   std::tuple<bound_argument<T_bound>...> bound_;
 
-  template <typename T, std::size_t... Is>
-  decltype(auto) call_functor_operator_parentheses(T&& tuple, std::index_sequence<Is...>)
+private:
+  template <std::size_t... Is, typename... T_arg>
+  decltype(auto) call_with_bound(std::index_sequence<Is...>, T_arg&&... arg)
   {
-    return (this->functor_)(std::get<Is>(std::forward<T>(tuple))...);
+    // For instance, if I_location is 1, and arg has 4 arguments,
+    // we would want to call the functor with (arg0, bound, arg1, arg2, arg3).
+    // Rotating the arguments to (arg1, arg2, arg3, arg0), appending bound, and
+    // rotating (arg1, arg2, arg3) to the end gives that, without copies.
+    const auto append_bound = [this](auto&&... rotated) -> decltype(auto) {
+      return internal::rotate_and_call<sizeof...(T_arg) - I_location>::call(this->functor_,
+        std::forward<decltype(rotated)>(rotated)..., std::get<Is>(bound_).invoke()...);
+    };
+    return internal::rotate_and_call<I_location>::call(append_bound, std::forward<T_arg>(arg)...);
   }
 };
 
@@ -193,22 +186,19 @@ public:
   decltype(auto) operator()(T_arg&&... arg)
   {
     // For instance, if arg has 4 arguments,
-    // we would want to call operator() with (arg0, arg1, arg2, bound).
-
-    const auto t_args = std::tuple<T_arg...>(std::forward<T_arg>(arg)...);
-    const auto t_bound = internal::tuple_transform_each<internal::TransformEachInvoker>(bound_);
-    const auto t_with_bound = std::tuple_cat(t_args, t_bound);
-
-    constexpr auto seq = std::make_index_sequence<std::tuple_size<decltype(t_with_bound)>::value>();
-    return call_functor_operator_parentheses(t_with_bound, seq);
+    // we would want to call the functor with (arg0, arg1, arg2, arg3, bound).
+    return call_with_bound(std::index_sequence_for<T_type...>(), std::forward<T_arg>(arg)...);
   }
 
   /** Constructs a bind_functor object that binds an argument to the passed functor.
+   * The bound arguments are constructed in place from @e bound, moving rvalues.
    * @param func Functor to invoke from operator()().
    * @param bound Arguments to bind to the functor.
    */
-  bind_functor(type_trait_take_t<T_functor> func, type_trait_take_t<T_type>... bound)
-  : adapts<T_functor>(func), bound_(bound...)
+  template <typename... T_arg,
+    typename = std::enable_if_t<sizeof...(T_arg) == sizeof...(T_type)>>
+  bind_functor(type_trait_take_t<T_functor> func, T_arg&&... bound)
+  : adapts<T_functor>(func), bound_(std::forward<T_arg>(bound)...)
   {
   }
 
@@ -216,10 +206,10 @@ public:
   std::tuple<bound_argument<T_type>...> bound_;
 
 private:
-  template <typename T, std::size_t... Is>
-  decltype(auto) call_functor_operator_parentheses(T&& tuple, std::index_sequence<Is...>)
+  template <std::size_t... Is, typename... T_arg>
+  decltype(auto) call_with_bound(std::index_sequence<Is...>, T_arg&&... arg)
   {
-    return (this->functor_)(std::get<Is>(std::forward<T>(tuple))...);
+    return (this->functor_)(std::forward<T_arg>(arg)..., std::get<Is>(bound_).invoke()...);
   }
 };
 
@@ -239,7 +229,7 @@ struct visitor<bind_functor<T_loc, T_functor, T_bound...>>
     const T_action& action, const bind_functor<T_loc, T_functor, T_bound...>& target)
   {
     sigc::visit_each(action, target.functor_);
-    sigc::visit_each(action, std::get<0>(target.bound_));
+    sigc::internal::tuple_for_each<internal::TupleVisitorVisitEach>(target.bound_, action);
   }
 };
 
@@ -265,13 +255,101 @@ struct visitor<bind_functor<-1, T_functor, T_type...>>
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace internal
+{
+
+// Retrieves a bound argument, as it was passed to bind().
+template <typename T_type>
+inline const T_type&
+bound_value(const bound_argument<T_type>& arg)
+{
+  return arg.visit();
+}
+
+template <typename T_type>
+inline std::reference_wrapper<T_type>
+bound_value(const bound_argument<std::reference_wrapper<T_type>>& arg)
+{
+  return std::ref(arg.visit().invoke());
+}
+
+template <typename T_type>
+inline std::reference_wrapper<const T_type>
+bound_value(const bound_argument<std::reference_wrapper<const T_type>>& arg)
+{
+  return std::cref(arg.visit().invoke());
+}
+
+// bind<N>(bind<N>(func, a...), b...) inserts a... and then b... at position N.
+template <int I_location, typename T_functor, typename... T_inner, typename... T_bound,
+  std::size_t... Is>
+inline decltype(auto)
+fuse_bind(const bind_functor<I_location, T_functor, T_inner...>& func,
+  std::index_sequence<Is...>, T_bound&&... b)
+{
+  using adaptor_type = typename adaptor_trait<T_functor>::adaptor_type;
+  return bind_functor<I_location, adaptor_type, T_inner..., std::decay_t<T_bound>...>(
+    func.functor_, bound_value(std::get<Is>(func.bound_))..., std::forward<T_bound>(b)...);
+}
+
+// bind(bind(func, a...), b...) appends b... and then a...
+template <typename T_functor, typename... T_inner, typename... T_bound, std::size_t... Is>
+inline decltype(auto)
+fuse_bind(const bind_functor<-1, T_functor, T_inner...>& func, std::index_sequence<Is...>,
+  T_bound&&... b)
+{
+  using adaptor_type = typename adaptor_trait<T_functor>::adaptor_type;
+  return bind_functor<-1, adaptor_type, std::decay_t<T_bound>..., T_inner...>(
+    func.functor_, std::forward<T_bound>(b)..., bound_value(std::get<Is>(func.bound_))...);
+}
+
+/** Creates the functor that bind<I_location>() returns.
+ * The bound arguments are forwarded, so that they are moved into the bind_functor.
+ * Nested bind() calls with the same location are fused into one bind_functor.
+ * bind() of a hide_functor with the same location returns the functor that
+ * the hide_functor wraps, because the bound argument would be ignored.
+ * Arguments bound with std::ref() or std::cref() are still bound in that case,
+ * because the slot must track them if they are trackable objects.
+ */
+template <int I_location>
+struct bind_maker
+{
+  template <typename T_functor, typename... T_bound>
+  static decltype(auto) make(const T_functor& func, T_bound&&... b)
+  {
+    return bind_functor<I_location, T_functor, std::decay_t<T_bound>...>(
+      func, std::forward<T_bound>(b)...);
+  }
+
+  template <typename T_functor, typename... T_inner, typename... T_bound>
+  static decltype(auto) make(
+    const bind_functor<I_location, T_functor, T_inner...>& func, T_bound&&... b)
+  {
+    return fuse_bind(func, std::index_sequence_for<T_inner...>(), std::forward<T_bound>(b)...);
+  }
+
+  template <typename T_functor, typename T_bound,
+    typename = std::enable_if_t<std::is_same<typename unwrap_reference<std::decay_t<T_bound>>::type,
+      std::decay_t<T_bound>>::value>>
+  static decltype(auto) make(const hide_functor<I_location, T_functor>& func, T_bound&&)
+  {
+    return func.functor_;
+  }
+};
+
+} /* namespace internal */
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /** Creates an adaptor of type sigc::bind_functor which binds the passed argument to the passed
  * functor.
  * The optional template argument @e I_location specifies the zero-based
  * position of the argument to be fixed (@p -1 stands for the last argument).
  *
  * @param func Functor that should be wrapped.
- * @param b Arguments to bind to @e func.
+ * @param b Arguments to bind to @e func. They are moved into the returned functor,
+ *   so rvalues are not copied, and move-only types such as std::unique_ptr can be bound.
  * @return Adaptor that executes @e func with the bound argument on invocation.
  *
  * @ingroup bind
@@ -280,7 +358,7 @@ template <int I_location, typename T_functor, typename... T_bound>
 inline decltype(auto)
 bind(const T_functor& func, T_bound... b)
 {
-  return bind_functor<I_location, T_functor, T_bound...>(func, b...);
+  return internal::bind_maker<I_location>::make(func, std::move(b)...);
 }
 
 /** Creates an adaptor of type sigc::bind_functor which fixes the last arguments of the passed
@@ -288,7 +366,8 @@ bind(const T_functor& func, T_bound... b)
  * This function overload fixes the last arguments of @e func.
  *
  * @param func Functor that should be wrapped.
- * @param b Arguments to bind to @e func.
+ * @param b Arguments to bind to @e func. They are moved into the returned functor,
+ *   so rvalues are not copied, and move-only types such as std::unique_ptr can be bound.
  * @return Adaptor that executes func with the bound argument on invocation.
  *
  * @ingroup bind
@@ -297,7 +376,7 @@ template <typename T_functor, typename... T_type>
 inline decltype(auto)
 bind(const T_functor& func, T_type... b)
 {
-  return bind_functor<-1, T_functor, T_type...>(func, b...);
+  return internal::bind_maker<-1>::make(func, std::move(b)...);
 }
 
 } /* namespace sigc */
@@ -49,7 +49,8 @@ struct bind_return_functor : public adapts<T_functor>
   template <typename... T_arg>
   inline typename unwrap_reference<T_return>::type operator()(T_arg... a)
   {
-    this->functor_.template operator()<type_trait_pass_t<T_arg>...>(a...);
+    this->functor_.template operator()<type_trait_pass_t<T_arg>...>(
+      static_cast<type_trait_pass_t<T_arg>>(a)...);
     return ret_value_.invoke();
   }
 
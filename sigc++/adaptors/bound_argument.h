@@ -21,6 +21,7 @@
 
 #include <sigc++/limit_reference.h>
 #include <sigc++/reference_wrapper.h>
+#include <utility>
 
 namespace sigc
 {
@@ -38,7 +39,9 @@ namespace sigc
  * then this object is implemented on top of a const_limit_reference.
  *
  * If Foo is something else (such as an argument that is bound by value) bound_argument just
- * stores a cop of that value, and both invoke() and visit() simply return it.
+ * stores a copy of that value, and both invoke() and visit() simply return it.
+ * A value that is passed as an rvalue is moved, so it may be a move-only type
+ * such as std::unique_ptr.
  *
  * This object is used by the bind_functor<> and bind_return_functor<> objects,
  * depending on whether the argument is bound as a parameter or as a return value.
@@ -55,6 +58,11 @@ public:
    */
   bound_argument(const T_type& arg) : visited_(arg) {}
 
+  /** Constructor.
+   * @param arg The argument to bind, which is moved into this object.
+   */
+  bound_argument(T_type&& arg) : visited_(std::move(arg)) {}
+
   /** Retrieve the entity to visit in visit_each().
    * @return The bound argument.
    */
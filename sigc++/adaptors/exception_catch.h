@@ -93,7 +93,8 @@ struct exception_catch_functor : public adapts<T_functor>
   {
     try
     {
-      return this->functor_.template operator()<type_trait_pass_t<T_arg>...>(a...);
+      return this->functor_.template operator()<type_trait_pass_t<T_arg>...>(
+        static_cast<type_trait_pass_t<T_arg>>(a)...);
     }
     catch (...)
     {
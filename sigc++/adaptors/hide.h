@@ -20,8 +20,6 @@
 #define SIGC_ADAPTORS_HIDE_H
 
 #include <sigc++/adaptors/adapts.h>
-#include <sigc++/tuple-utils/tuple_end.h>
-#include <sigc++/tuple-utils/tuple_start.h>
 
 namespace sigc
 {
@@ -96,34 +94,23 @@ struct hide_functor : public adapts<T_functor>
   {
     constexpr auto size = sizeof...(T_arg);
     constexpr auto index_ignore = (I_location == -1 ? size - 1 : I_location);
-    const auto t = std::tuple<T_arg...>(std::forward<T_arg>(a)...);
-
-    const auto t_start = internal::tuple_start<index_ignore>(t);
-    const auto t_end = internal::tuple_end<size - index_ignore - 1>(t);
-    const auto t_used = std::tuple_cat(t_start, t_end);
-
-    constexpr auto size_used = size - 1;
-
-    // TODO: Remove these? They are just here as a sanity check.
-    static_assert(std::tuple_size<decltype(t_used)>::value == size_used, "Unexpected t_used size.");
-
-    const auto seq = std::make_index_sequence<size_used>();
-    return call_functor_operator_parentheses(t_used, seq);
+    static_assert(index_ignore < size, "I_location must be less than the number of arguments.");
+
+    // For instance, if I_location is 1, and a has 4 arguments,
+    // we would want to call the functor with (a0, a2, a3).
+    // Rotating the arguments to (a1, a2, a3, a0), dropping a1, and rotating
+    // (a2, a3) to the end gives that, without copies.
+    const auto drop_first = [this](auto&& /* hidden */, auto&&... rotated) -> decltype(auto) {
+      return internal::rotate_and_call<size - index_ignore - 1>::call(
+        this->functor_, std::forward<decltype(rotated)>(rotated)...);
+    };
+    return internal::rotate_and_call<index_ignore>::call(drop_first, std::forward<T_arg>(a)...);
   }
 
   /** Constructs a hide_functor object that adds a dummy parameter to the passed functor.
    * @param func Functor to invoke from operator()().
    */
   explicit hide_functor(const T_functor& func) : adapts<T_functor>(func) {}
-
-private:
-  // TODO_variadic: Replace this with std::experimental::apply() if that becomes standard
-  // C++, or add our own implementation, to avoid code duplication.
-  template <typename T_tuple, std::size_t... Is>
-  decltype(auto) call_functor_operator_parentheses(T_tuple& tuple, std::index_sequence<Is...>)
-  {
-    return this->functor_.template operator()(std::get<Is>(tuple)...);
-  }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
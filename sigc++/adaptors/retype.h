@@ -67,6 +67,20 @@ namespace sigc
  * @ingroup adaptors
  */
 
+namespace internal
+{
+
+/** The type to which retype_functor casts an argument of type @e T_arg.
+ * An argument that already has the parameter type @e T_type is passed on
+ * by reference, without a copy.
+ */
+template <typename T_type, typename T_arg>
+using retype_cast_t =
+  std::conditional_t<std::is_same<std::decay_t<T_type>, std::decay_t<T_arg>>::value,
+    type_trait_take_t<T_type>, T_type>;
+
+} /* namespace internal */
+
 /** Adaptor that performs C-style casts on the parameters passed on to the functor.
  * Use the convenience function sigc::retype() to create an instance of retype_functor.
  *
@@ -80,10 +94,10 @@ template <typename T_functor, typename... T_type>
 struct retype_functor : public adapts<T_functor>
 {
   template <typename... T_arg>
-  decltype(auto) operator()(T_arg... a)
+  decltype(auto) operator()(T_arg&&... a)
   {
     return this->functor_.template operator()<type_trait_take_t<T_type>...>(
-      static_cast<T_type>(a)...);
+      static_cast<internal::retype_cast_t<T_type, T_arg>>(std::forward<T_arg>(a))...);
   }
 
   /** Constructs a retype_functor object that performs C-style casts on the parameters passed on to
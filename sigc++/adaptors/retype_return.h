@@ -81,7 +81,7 @@ struct retype_return_functor<void, T_functor> : public adapts<T_functor>
   template <typename... T_arg>
   inline void operator()(T_arg... a)
   {
-    this->functor_.template operator()<T_arg...>(a...);
+    this->functor_.template operator()<T_arg...>(std::forward<T_arg>(a)...);
   }
 
   retype_return_functor() = default;
@@ -146,5 +146,24 @@ hide_return(const T_functor& functor)
   return retype_return_functor<void, T_functor>(functor);
 }
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+// A second cast to the same type changes nothing. retype_return<T>() and
+// hide_return() of a retype_return_functor with the same target type
+// return a copy of it, instead of wrapping it in another layer.
+template <typename T_return, typename T_functor>
+inline retype_return_functor<T_return, T_functor>
+retype_return(const retype_return_functor<T_return, T_functor>& functor)
+{
+  return functor;
+}
+
+template <typename T_functor>
+inline retype_return_functor<void, T_functor>
+hide_return(const retype_return_functor<void, T_functor>& functor)
+{
+  return functor;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 } /* namespace sigc */
 #endif /* SIGC_ADAPTORS_RETYPE_RETURN_H */
@@ -18,22 +18,26 @@
  */
 
 #include <sigc++/connection.h>
+#include <sigc++/stats.h>
 
 namespace sigc
 {
 
 connection::connection() noexcept : slot_(nullptr)
 {
+  internal::stats_add(internal::stats_object::connection, sizeof(connection));
 }
 
 connection::connection(slot_base& slot)
 : slot_(&slot)
 {
+  internal::stats_add(internal::stats_object::connection, sizeof(connection));
 }
 
 
 connection::connection(const connection& c) : slot_(c.slot_)
 {
+  internal::stats_add(internal::stats_object::connection, sizeof(connection));
 }
 
 connection&
@@ -45,6 +49,7 @@ connection::operator=(const connection& src)
 
 connection::~connection()
 {
+  internal::stats_remove(internal::stats_object::connection, sizeof(connection));
 }
 
 bool
@@ -21,6 +21,7 @@
 #include <sigc++/type_traits.h>
 #include <sigc++/limit_reference.h>
 #include <sigc++/member_method_trait.h>
+#include <utility>
 
 // implementation notes:
 //  - we do not use bind here, because it would introduce
@@ -83,6 +84,20 @@ namespace sigc
  * sigc::slot<void(int)> sl = sigc::mem_fun1<int>(my_foo, &foo::bar);
  * @endcode
  *
+ * The method can also be passed as a template argument. Then it's part of the
+ * functor's type, which stores only a pointer to the object and calls the
+ * method directly, so that the compiler can inline the call.
+ *
+ * @par Example:
+ * @code
+ * struct foo : public sigc::trackable
+ * {
+ *   void bar(int) {}
+ * };
+ * foo my_foo;
+ * sigc::slot<void(int)> sl = sigc::mem_fun<&foo::bar>(my_foo);
+ * @endcode
+ *
  * @ingroup sigcfunctors
  */
 
@@ -113,7 +128,7 @@ public:
    */
   decltype(auto) operator()(obj_type_with_modifier& obj, type_trait_take_t<T_arg>... a) const
   {
-    return (obj.*func_ptr_)(a...);
+    return (obj.*func_ptr_)(std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
 protected:
@@ -152,7 +167,20 @@ public:
    */
   decltype(auto) operator()(type_trait_take_t<T_arg>... a) const
   {
-    return (obj_.invoke().*(this->func_ptr_))(a...);
+    return (obj_.invoke().*(this->func_ptr_))(std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Execute the wrapped method, moving the arguments that are passed as rvalues.
+   * This overload exists only if some argument types are copied when the
+   * method is called with lvalues, and moved when it's called with rvalues.
+   * @param a Arguments to be passed on to the method.
+   * @return The return value of the method invocation.
+   */
+  template <bool I_forwarding = internal::is_forwarding_signature<T_arg...>(),
+    typename = std::enable_if_t<I_forwarding>>
+  decltype(auto) operator()(type_trait_forward_t<T_arg>... a) const
+  {
+    return (obj_.invoke().*(this->func_ptr_))(std::forward<type_trait_forward_t<T_arg>>(a)...);
   }
 
   // protected:
@@ -161,6 +189,50 @@ public:
   T_limit_reference obj_;
 };
 
+/** Functor that calls the method @e I_method on an object instance.
+ * Unlike bound_mem_functor, it doesn't store a pointer to the method,
+ * because the method is part of its type. It stores only a pointer to
+ * the object, and it calls the method directly, which can be inlined.
+ * Use the convenience function sigc::mem_fun<&T::method>(obj) to create
+ * an instance of sigc::bound_method_functor.
+ *
+ * The following template arguments are used:
+ * - @e I_method The method, such as &Foo::bar.
+ *
+ * @ingroup mem_fun
+ */
+template <auto I_method>
+class bound_method_functor
+{
+public:
+  using function_type = decltype(I_method);
+
+  using object_type = typename internal::member_method_class<function_type>::type;
+
+  using obj_type_with_modifier =
+    typename std::conditional_t<internal::member_method_is_const<function_type>::value,
+      const object_type, object_type>;
+
+  /** Constructs a bound_method_functor object that calls the method on the passed object.
+   * @param obj Reference to instance the method will operate on.
+   */
+  explicit bound_method_functor(obj_type_with_modifier& obj) : obj_(&obj) {}
+
+  /** Execute the method operating on the stored instance.
+   * @param a Arguments to be passed on to the method.
+   * @return The return value of the method invocation.
+   */
+  template <typename... T_arg>
+  decltype(auto) operator()(T_arg&&... a) const
+  {
+    return (obj_->*I_method)(std::forward<T_arg>(a)...);
+  }
+
+  // protected:
+  // Pointer to stored object instance.
+  obj_type_with_modifier* obj_;
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 // template specialization of visitor<>::do_visit_each<>(action, functor):
 /** Performs a functor on each of the targets of a functor.
@@ -179,6 +251,26 @@ struct visitor<bound_mem_functor<T_func, T_arg...>>
     sigc::visit_each(action, target.obj_);
   }
 };
+
+// template specialization of visitor<>::do_visit_each<>(action, functor):
+/** Performs a functor on each of the targets of a functor.
+ * The function overload for sigc::bound_method_functor performs a functor
+ * on the object instance stored in the sigc::bound_method_functor object.
+ * The limit_reference, which finds the object's sigc::trackable base, is
+ * created only here, so that the functor needs to store only one pointer.
+ *
+ * @ingroup mem_fun
+ */
+template <auto I_method>
+struct visitor<bound_method_functor<I_method>>
+{
+  template <typename T_action>
+  static void do_visit_each(const T_action& action, const bound_method_functor<I_method>& target)
+  {
+    using obj_type = typename bound_method_functor<I_method>::obj_type_with_modifier;
+    sigc::visit_each(action, limit_reference<obj_type>(*target.obj_));
+  }
+};
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 /** Creates a functor of type sigc::mem_functor which wraps a  method.
@@ -293,5 +385,24 @@ mem_fun(/*const*/ T_obj& obj, T_return (T_obj2::*func)(T_arg...) const volatile)
   return bound_mem_functor<T_return (T_obj::*)(T_arg...) const volatile, T_arg...>(obj, func);
 }
 
+/** Creates a functor of type sigc::bound_method_functor which calls the method @e I_method
+ * on an object instance.
+ * The method is a template argument, so the functor stores only a pointer to the object.
+ * If the method is overloaded, cast it to the wanted type, for instance
+ * sigc::mem_fun<static_cast<void (foo::*)(int)>(&foo::bar)>(my_foo).
+ * @param obj Reference to object instance the functor should operate on.
+ * @return Functor that executes @e I_method on invocation.
+ *
+ * @ingroup mem_fun
+ */
+template <auto I_method, typename T_obj>
+inline decltype(auto)
+mem_fun(T_obj& obj)
+{
+  static_assert(std::is_member_function_pointer<decltype(I_method)>::value,
+    "The template argument of mem_fun() must be a pointer to a method.");
+  return bound_method_functor<I_method>(obj);
+}
+
 } /* namespace sigc */
 #endif /* SIGC_FUNCTORS_MEM_FUN_H */
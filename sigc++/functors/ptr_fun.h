@@ -19,6 +19,7 @@
 #ifndef SIGC_FUNCTORS_PTR_FUN_H
 #define SIGC_FUNCTORS_PTR_FUN_H
 #include <sigc++/type_traits.h>
+#include <utility>
 
 namespace sigc
 {
@@ -55,6 +56,16 @@ namespace sigc
  * sigc::slot<void(int)> sl = sigc::ptr_fun(&foo::bar);
  * @endcode
  *
+ * The function can also be passed as a template argument. The functor then
+ * stores nothing at all, so a slot that is created from it needs no memory
+ * on the heap.
+ *
+ * @par Example:
+ * @code
+ * void foo(int) {}
+ * sigc::slot<void(int)> sl = sigc::ptr_fun<&foo>();
+ * @endcode
+ *
  * @ingroup sigcfunctors
  */
 
@@ -92,7 +103,23 @@ public:
    * @param a Arguments to be passed on to the function.
    * @return The return value of the function invocation.
    */
-  T_return operator()(type_trait_take_t<T_args>... a) const { return func_ptr_(a...); }
+  T_return operator()(type_trait_take_t<T_args>... a) const
+  {
+    return func_ptr_(std::forward<type_trait_take_t<T_args>>(a)...);
+  }
+
+  /** Execute the wrapped function, moving the arguments that are passed as rvalues.
+   * This overload exists only if some argument types are copied when the
+   * function is called with lvalues, and moved when it's called with rvalues.
+   * @param a Arguments to be passed on to the function.
+   * @return The return value of the function invocation.
+   */
+  template <bool I_forwarding = internal::is_forwarding_signature<T_args...>(),
+    typename = std::enable_if_t<I_forwarding>>
+  T_return operator()(type_trait_forward_t<T_args>... a) const
+  {
+    return func_ptr_(std::forward<type_trait_forward_t<T_args>>(a)...);
+  }
 };
 
 /** Creates a functor of type sigc::pointer_functor which wraps an existing non-member function.
@@ -107,5 +134,49 @@ inline decltype(auto) ptr_fun(T_return (*func)(T_args...))
   return pointer_functor<T_return(T_args...)>(func);
 }
 
+/** static_pointer_functor calls the function @e I_func.
+ * Unlike pointer_functor, it doesn't store a function pointer, because the
+ * function is part of its type. It's an empty class, so a slot can hold it
+ * without allocating memory.
+ * Use the convenience function sigc::ptr_fun<&func>() to create an instance
+ * of sigc::static_pointer_functor.
+ *
+ * The following template arguments are used:
+ * - @e I_func The function, such as &foo.
+ *
+ * @ingroup ptr_fun
+ */
+template <auto I_func>
+class static_pointer_functor
+{
+public:
+  /** Execute the function.
+   * @param a Arguments to be passed on to the function.
+   * @return The return value of the function invocation.
+   */
+  template <typename... T_arg>
+  decltype(auto) operator()(T_arg&&... a) const
+  {
+    return I_func(std::forward<T_arg>(a)...);
+  }
+};
+
+/** Creates a functor of type sigc::static_pointer_functor which calls the function @e I_func.
+ * If the function is overloaded, cast it to the wanted type, for instance
+ * sigc::ptr_fun<static_cast<void (*)(int)>(&foo)>().
+ * @return Functor that executes @e I_func on invocation.
+ *
+ * @ingroup ptr_fun
+ */
+template <auto I_func>
+inline decltype(auto)
+ptr_fun()
+{
+  static_assert(std::is_pointer<decltype(I_func)>::value &&
+                  std::is_function<std::remove_pointer_t<decltype(I_func)>>::value,
+    "The template argument of ptr_fun() must be a pointer to a function.");
+  return static_pointer_functor<I_func>();
+}
+
 } /* namespace sigc */
 #endif /* SIGC_FUNCTORS_PTR_FUN_H */
@@ -20,11 +20,16 @@
 #define SIGC_FUNCTORS_SLOT_H
 
 #include <sigc++/trackable.h>
+#include <sigc++/instrumentation.h>
+#include <sigc++/stats.h>
 #include <sigc++/visit_each.h>
 #include <sigc++/adaptors/adaptor_trait.h>
 #include <sigc++/functors/slot_base.h>
 
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 namespace sigc
 {
@@ -51,6 +56,9 @@ public:
   /** The functor contained by this slot_rep object. */
   std::unique_ptr<adaptor_type> functor_;
 
+  /// Returns the functor contained by this slot_rep object.
+  inline adaptor_type& get_functor() noexcept { return *functor_; }
+
   /** Constructs an invalid typed slot_rep object.
    * The notification callback is registered using visit_each().
    * @param functor The functor contained by the new slot_rep object.
@@ -58,12 +66,25 @@ public:
   inline explicit typed_slot_rep(const T_functor& functor)
   : slot_rep(nullptr), functor_(std::make_unique<adaptor_type>(functor))
   {
+    stats_add(stats_object::slot_rep, stats_size());
+    sigc::visit_each_trackable(slot_do_bind(this), *functor_);
+  }
+
+  /** Constructs an invalid typed slot_rep object, moving the functor.
+   * The notification callback is registered using visit_each().
+   * @param functor The functor contained by the new slot_rep object.
+   */
+  inline explicit typed_slot_rep(T_functor&& functor)
+  : slot_rep(nullptr), functor_(std::make_unique<adaptor_type>(std::move(functor)))
+  {
+    stats_add(stats_object::slot_rep, stats_size());
     sigc::visit_each_trackable(slot_do_bind(this), *functor_);
   }
 
   inline typed_slot_rep(const typed_slot_rep& src)
   : slot_rep(src.call_), functor_(std::make_unique<adaptor_type>(*src.functor_))
   {
+    stats_add(stats_object::slot_rep, stats_size());
     sigc::visit_each_trackable(slot_do_bind(this), *functor_);
   }
 
@@ -77,9 +98,17 @@ public:
     // Call destroy() non-virtually.
     // It's unwise to make virtual calls in a constructor or destructor.
     typed_slot_rep::destroy();
+    stats_remove(stats_object::slot_rep, stats_size());
+    slot_rep_destroyed(this);
   }
 
 private:
+  /// The size of this slot_rep and its functor, as reported by sigc::stats().
+  static constexpr std::size_t stats_size() noexcept
+  {
+    return sizeof(typed_slot_rep) + sizeof(adaptor_type);
+  }
+
   /** Detaches the stored functor from the other referred trackables and destroys it.
    * This does not destroy the base slot_rep object.
    */
@@ -101,14 +130,101 @@ private:
    * Deep copy means that the notification callback of the new
    * slot_rep object is registered in the referred trackables.
    * @return A deep copy of the slot_rep object.
+   * @throw std::logic_error If the functor can't be copied.
    */
-  slot_rep* clone() const override { return new typed_slot_rep(*this); }
+  slot_rep* clone() const override { return clone(std::is_copy_constructible<adaptor_type>()); }
+
+  slot_rep* clone(std::true_type /* copyable */) const { return new typed_slot_rep(*this); }
+
+  // The slot type doesn't know the functor type, so a copy of a slot with a
+  // move-only functor can't be rejected at compile time. Don't let it
+  // silently drop the functor.
+  [[noreturn]] slot_rep* clone(std::false_type /* copyable */) const
+  {
+    throw std::logic_error("sigc::slot: a slot with a move-only functor can't be copied");
+  }
 };
 
+/** Whether a functor of type @e T_functor has no state.
+ * That's the case for empty, trivially copyable types, such as captureless
+ * lambdas and sigc::ptr_fun<&func>(). All objects of such a type are
+ * interchangeable, and they can't refer to a trackable.
+ */
+template <typename T_functor>
+struct is_stateless_functor
+: public std::integral_constant<bool,
+    std::is_empty<T_functor>::value && std::is_trivially_copyable<T_functor>::value>
+{
+};
+
+/** A slot_rep of a stateless functor.
+ * It holds the functor in place, because the functor takes no space.
+ * One statically allocated stateless_slot_rep is shared by all slots of the
+ * same functor type and signature that are not connected to a signal, see
+ * slot_base::shared_rep_. Slots that are connected get their own copy.
+ */
+template <typename T_functor>
+struct stateless_slot_rep : public slot_rep
+{
+private:
+  using adaptor_type = typename adaptor_trait<T_functor>::adaptor_type;
+
+public:
+  /** The functor contained by this slot_rep object. */
+  adaptor_type functor_;
+
+  /// Returns the functor contained by this slot_rep object.
+  inline adaptor_type& get_functor() noexcept { return functor_; }
+
+  /** Constructs the shared slot_rep object of a functor type and signature.
+   * It's not counted by sigc::stats(), because it's not on the heap.
+   * @param functor The functor contained by the new slot_rep object.
+   * @param call The function that invokes the functor.
+   */
+  inline stateless_slot_rep(const T_functor& functor, hook call)
+  : slot_rep(call), functor_(functor)
+  {
+  }
+
+  inline stateless_slot_rep(const stateless_slot_rep& src)
+  : slot_rep(src.call_), functor_(src.functor_)
+  {
+    stats_add(stats_object::slot_rep, sizeof(stateless_slot_rep));
+  }
+
+  stateless_slot_rep& operator=(const stateless_slot_rep& src) = delete;
+
+  stateless_slot_rep(stateless_slot_rep&& src) = delete;
+  stateless_slot_rep& operator=(stateless_slot_rep&& src) = delete;
+
+  // Only the copies are destroyed. The shared slot_rep lives until the program exits.
+  ~stateless_slot_rep() override
+  {
+    stats_remove(stats_object::slot_rep, sizeof(stateless_slot_rep));
+    slot_rep_destroyed(this);
+  }
+
+private:
+  /** A stateless functor refers to no trackables, so there is nothing to detach.
+   */
+  void destroy() override { call_ = nullptr; }
+
+  /** Makes a copy of the slot_rep object, which a slot owns.
+   * @return A copy of the slot_rep object.
+   */
+  slot_rep* clone() const override { return new stateless_slot_rep(*this); }
+};
+
+/// The type of slot_rep that holds a functor of type @e T_functor.
+template <typename T_functor>
+using slot_rep_t = std::conditional_t<is_stateless_functor<T_functor>::value,
+  stateless_slot_rep<T_functor>, typed_slot_rep<T_functor>>;
+
 /** Abstracts functor execution.
  * call_it() invokes a functor of type @e T_functor with a list of
  * parameters whose types are given by the template arguments.
- * address() forms a function pointer from call_it().
+ * address() forms a function pointer from call_it(), or from
+ * call_it_forwarding() if is_forwarding_signature<T_arg...>().
  *
  * The following template arguments are used:
  * - @e T_functor The functor type.
@@ -126,16 +242,92 @@ struct slot_call
    */
   static T_return call_it(slot_rep* rep, type_trait_take_t<T_arg>... a_)
   {
-    auto typed_rep = static_cast<typed_slot_rep<T_functor>*>(rep);
-    return (*typed_rep->functor_).template operator()<type_trait_take_t<T_arg>...>(a_...);
+    auto typed_rep = static_cast<slot_rep_t<T_functor>*>(rep);
+    return typed_rep->get_functor().template operator()<type_trait_take_t<T_arg>...>(
+      std::forward<type_trait_take_t<T_arg>>(a_)...);
   }
 
-  /** Forms a function pointer from call_it().
-   * @return A function pointer formed from call_it().
+  /** Invokes a functor of type @p T_functor, which may move its arguments.
+   * @param rep slot_rep object that holds a functor of type @p T_functor.
+   * @param may_move Whether the arguments may be passed on as rvalues.
+   * @param a Arguments to be passed on to the functor.
+   * @return The return values of the functor invocation.
    */
-  static hook address() { return reinterpret_cast<hook>(&call_it); }
+  static T_return call_it_forwarding(slot_rep* rep, bool may_move, type_trait_take_t<T_arg>... a_)
+  {
+    if (!may_move)
+      return call_it(rep, std::forward<type_trait_take_t<T_arg>>(a_)...);
+
+    auto typed_rep = static_cast<slot_rep_t<T_functor>*>(rep);
+    return typed_rep->get_functor().template operator()<type_trait_forward_t<T_arg>...>(
+      forward_arg<T_arg>::convert(std::forward<type_trait_take_t<T_arg>>(a_))...);
+  }
+
+  /** Forms a function pointer from call_it() or call_it_forwarding().
+   * @return A function pointer of type slot_call_type<T_return, T_arg...>::type.
+   */
+  static hook address()
+  {
+    return address(std::integral_constant<bool, is_forwarding_signature<T_arg...>()>());
+  }
+
+private:
+  static hook address(std::false_type) { return reinterpret_cast<hook>(&call_it); }
+  static hook address(std::true_type) { return reinterpret_cast<hook>(&call_it_forwarding); }
+};
+
+/** The type of slot_rep::call_ in a slot<T_return(T_arg...)>.
+ * If is_forwarding_signature<T_arg...>(), the function takes a flag
+ * that tells whether the slot may move its arguments.
+ */
+template <typename T_return, typename... T_arg>
+struct slot_call_type
+{
+  using type = std::conditional_t<is_forwarding_signature<T_arg...>(),
+    T_return (*)(slot_rep*, bool, type_trait_take_t<T_arg>...),
+    T_return (*)(slot_rep*, type_trait_take_t<T_arg>...)>;
+};
+
+/** Calls the function in slot_rep::call_ of a slot<T_return(T_arg...)>.
+ * The function's type is slot_call_type<T_return, T_arg...>::type.
+ */
+template <typename T_return, bool I_forwarding, typename... T_arg>
+struct slot_rep_caller
+{
+  static T_return call(slot_rep* rep, bool, type_trait_take_t<T_arg>... a)
+  {
+    using call_type = typename slot_call_type<T_return, T_arg...>::type;
+    return reinterpret_cast<call_type>(rep->call_)(
+      rep, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+};
+
+template <typename T_return, typename... T_arg>
+struct slot_rep_caller<T_return, true, T_arg...>
+{
+  static T_return call(slot_rep* rep, bool may_move, type_trait_take_t<T_arg>... a)
+  {
+    using call_type = typename slot_call_type<T_return, T_arg...>::type;
+    return reinterpret_cast<call_type>(rep->call_)(
+      rep, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
 };
 
+/** Calls the function in slot_rep::call_ of a slot<T_return(T_arg...)>.
+ * @param rep The slot_rep of the slot. It must not be empty.
+ * @param may_move Whether the slot may move the arguments. This is ignored
+ * unless is_forwarding_signature<T_arg...>().
+ * @param a Arguments to be passed on to the functor.
+ * @return The return value of the functor invocation.
+ */
+template <typename T_return, typename... T_arg>
+inline T_return
+call_slot_rep(slot_rep* rep, bool may_move, type_trait_take_t<T_arg>... a)
+{
+  return slot_rep_caller<T_return, is_forwarding_signature<T_arg...>(), T_arg...>::call(
+    rep, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+}
+
 } /* namespace internal */
 
 // Because slot is opaque, visit_each() will not visit its internal members.
@@ -181,7 +373,7 @@ private:
   using rep_type = internal::slot_rep;
 
 public:
-  using call_type = T_return (*)(rep_type*, type_trait_take_t<T_arg>...);
+  using call_type = typename internal::slot_call_type<T_return, T_arg...>::type;
 #endif
 
   /** Invoke the contained functor unless slot is in blocking state.
@@ -190,37 +382,63 @@ public:
    */
   inline T_return operator()(type_trait_take_t<T_arg>... a) const
   {
-    if (!empty() && !blocked())
-      return (reinterpret_cast<call_type>(slot_base::rep_->call_))(slot_base::rep_, a...);
-    return T_return();
+    return call(false, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Invoke the contained functor unless slot is in blocking state.
+   * The functor may move the arguments that are passed as rvalues.
+   * This overload exists only if some argument types are copied when the
+   * slot is called with lvalues, and moved when it's called with rvalues.
+   * @param a Arguments to be passed on to the functor.
+   * @return The return value of the functor invocation.
+   */
+  template <bool I_forwarding = internal::is_forwarding_signature<T_arg...>(),
+    typename = std::enable_if_t<I_forwarding>>
+  inline T_return operator()(type_trait_forward_t<T_arg>... a) const
+  {
+    return call(true, std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
   inline slot() = default;
 
   /** Constructs a slot from an arbitrary functor.
+   * A functor that is passed as an rvalue is moved into the slot.
+   * It may be move-only, such as a sigc::bind() of a std::unique_ptr.
+   * Such a slot can be moved, but copies of it are empty.
+   *
+   * A stateless functor, such as a captureless lambda or
+   * sigc::ptr_fun<&func>(), is not stored in the slot. The slot and its
+   * copies share a statically allocated slot_rep until they are connected
+   * to a signal, so they don't allocate memory.
    * @param func The desired functor the new slot should be assigned to.
    */
-  template <typename T_functor>
-  slot(const T_functor& func) : slot_base(new internal::typed_slot_rep<T_functor>(func))
+  template <typename T_functor,
+    typename = std::enable_if_t<!std::is_same<std::decay_t<T_functor>, slot>::value>>
+  slot(T_functor&& func)
+  : slot(std::forward<T_functor>(func), internal::is_stateless_functor<std::decay_t<T_functor>>())
   {
-    // The slot_base:: is necessary to stop the HP-UX aCC compiler from being confused. murrayc.
-    slot_base::rep_->call_ = internal::slot_call<T_functor, T_return, T_arg...>::address();
   }
 
   /** Constructs a slot, copying an existing one.
    * @param src The existing slot to copy.
+   * @throw std::logic_error If @a src contains a functor that can't be copied.
+   *        Move such a slot instead.
    */
   slot(const slot& src) = default;
 
   /** Constructs a slot, moving an existing one.
    * If @p src is connected to a parent (e.g. a signal), it is copied, not moved.
    * @param src The existing slot to move or copy.
+   * @throw std::logic_error If @a src must be copied and contains a functor
+   *        that can't be copied.
    */
   slot(slot&& src) : slot_base(std::move(src)) {}
 
   /** Overrides this slot, making a copy from another slot.
    * @param src The slot from which to make a copy.
    * @return @p this.
+   * @throw std::logic_error If @a src contains a functor that can't be copied.
+   *        This slot is then unchanged.
    */
   slot& operator=(const slot& src)
   = default;
@@ -229,12 +447,58 @@ public:
    * If @p src is connected to a parent (e.g. a signal), it is copied, not moved.
    * @param src The slot from which to move or copy.
    * @return @p this.
+   * @throw std::logic_error If @a src must be copied and contains a functor
+   *        that can't be copied. This slot is then unchanged.
    */
   slot& operator=(slot&& src)
   {
     slot_base::operator=(std::move(src));
     return *this;
   }
+
+private:
+  template <typename T_functor>
+  slot(T_functor&& func, std::false_type /* stateless */)
+  : slot_base(new internal::typed_slot_rep<std::decay_t<T_functor>>(std::forward<T_functor>(func)))
+  {
+    // The slot_base:: is necessary to stop the HP-UX aCC compiler from being confused. murrayc.
+    slot_base::rep_->call_ =
+      internal::slot_call<std::decay_t<T_functor>, T_return, T_arg...>::address();
+  }
+
+  template <typename T_functor>
+  slot(T_functor&& func, std::true_type /* stateless */)
+  : slot_base(shared_rep<std::decay_t<T_functor>>(func), true)
+  {
+  }
+
+  /** Returns the slot_rep that all unconnected slots of a stateless functor type share.
+   * It's never destroyed, so that slots in static objects can use it until the end.
+   * @param func A functor. All functors of the type are equal.
+   */
+  template <typename T_functor>
+  static rep_type* shared_rep(const T_functor& func)
+  {
+    using shared_rep_type = internal::stateless_slot_rep<T_functor>;
+    alignas(shared_rep_type) static unsigned char storage[sizeof(shared_rep_type)];
+    static rep_type* const rep = new (storage)
+      shared_rep_type(func, internal::slot_call<T_functor, T_return, T_arg...>::address());
+    return rep;
+  }
+
+  inline T_return call(bool may_move, type_trait_take_t<T_arg>... a) const
+  {
+    if (empty() || blocked())
+      return T_return();
+
+    if (!internal::instrumentation_active())
+      return internal::call_slot_rep<T_return, T_arg...>(
+        slot_base::rep_, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+
+    internal::slot_invocation_scope scope(nullptr, slot_base::rep_);
+    return internal::call_slot_rep<T_return, T_arg...>(
+      slot_base::rep_, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -267,8 +531,9 @@ struct visitor<slot<T_return, T_arg...>>
     const internal::limit_trackable_target<internal::slot_do_bind>& action,
     const slot<T_return, T_arg...>& target)
   {
+    // slot_base::set_parent() gives a slot that shares its slot_rep a copy of its own.
     if (target.rep_ && target.rep_->parent_ == nullptr)
-      target.rep_->set_parent(action.action_.rep_, &internal::slot_rep::notify_slot_rep_invalidated);
+      target.set_parent(action.action_.rep_, &internal::slot_rep::notify_slot_rep_invalidated);
   }
 
   static void do_visit_each(
@@ -18,7 +18,10 @@
  */
 
 #include <sigc++/functors/slot_base.h>
+#include <sigc++/signal_base.h>
 #include <sigc++/weak_raw_ptr.h>
+#include <sigc++/probes.h>
+#include <sigc++/stats.h>
 
 namespace
 {
@@ -26,7 +29,14 @@ namespace
 class dummy_slot_rep : public sigc::internal::slot_rep
 {
 public:
-  dummy_slot_rep() : slot_rep(nullptr) {}
+  dummy_slot_rep() : slot_rep(nullptr)
+  {
+    sigc::internal::stats_add(sigc::internal::stats_object::slot_rep, sizeof(dummy_slot_rep));
+  }
+  ~dummy_slot_rep() override
+  {
+    sigc::internal::stats_remove(sigc::internal::stats_object::slot_rep, sizeof(dummy_slot_rep));
+  }
   sigc::internal::slot_rep* clone() const override { return new dummy_slot_rep(); }
   void destroy() override {}
 };
@@ -61,6 +71,7 @@ slot_rep::disconnect()
   // https://bugzilla.gnome.org/show_bug.cgi?id=311057
   // See also https://bugzilla.gnome.org/show_bug.cgi?id=738602
   call_ = nullptr;
+  SIGC_PROBE2(disconnect, this, parent_);
 
   if (parent_)
   {
@@ -92,17 +103,29 @@ slot_rep::notify_slot_rep_invalidated(notifiable* data)
 
 } // namespace internal
 
-slot_base::slot_base() noexcept : rep_(nullptr), blocked_(false)
+slot_base::slot_base() noexcept : rep_(nullptr), blocked_(false), shared_rep_(false)
 {
 }
 
-slot_base::slot_base(rep_type* rep) noexcept : rep_(rep), blocked_(false)
+slot_base::slot_base(rep_type* rep) noexcept : rep_(rep), blocked_(false), shared_rep_(false)
 {
 }
 
-slot_base::slot_base(const slot_base& src) : rep_(nullptr), blocked_(src.blocked_)
+slot_base::slot_base(rep_type* rep, bool shared) noexcept
+: rep_(rep), blocked_(false), shared_rep_(shared)
 {
-  if (src.rep_)
+}
+
+slot_base::slot_base(const slot_base& src)
+: rep_(nullptr), blocked_(src.blocked_), shared_rep_(false)
+{
+  if (src.shared_rep_)
+  {
+    // A shared slot_rep is never invalidated. Share it too.
+    rep_ = src.rep_;
+    shared_rep_ = true;
+  }
+  else if (src.rep_)
   {
     // Check call_ so we can ignore invalidated slots.
     // Otherwise, destroyed bound reference parameters (whose destruction caused the slot's
@@ -110,18 +133,28 @@ slot_base::slot_base(const slot_base& src) : rep_(nullptr), blocked_(src.blocked
     // Note: I'd prefer to check somewhere during clone(). murrayc.
     if (src.rep_->call_)
       rep_ = src.rep_->clone();
-    else
+    if (!rep_)
     {
       *this = slot_base(); // Return the default invalid slot.
     }
   }
 }
 
-slot_base::slot_base(slot_base&& src) : rep_(nullptr), blocked_(src.blocked_)
+slot_base::slot_base(slot_base&& src)
+: rep_(nullptr), blocked_(src.blocked_), shared_rep_(src.shared_rep_)
 {
   if (src.rep_)
   {
-    if (src.rep_->parent_)
+    if (src.shared_rep_)
+    {
+      rep_ = src.rep_;
+
+      // Wipe src:
+      src.rep_ = nullptr;
+      src.blocked_ = false;
+      src.shared_rep_ = false;
+    }
+    else if (src.rep_->parent_)
     {
       // src is connected to a parent, e.g. a sigc::signal.
       // Copy, don't move! See https://bugzilla.gnome.org/show_bug.cgi?id=756484
@@ -131,7 +164,7 @@ slot_base::slot_base(slot_base&& src) : rep_(nullptr), blocked_(src.blocked_)
       // caused the slot's invalidation) may be used during clone().
       if (src.rep_->call_)
         rep_ = src.rep_->clone();
-      else
+      if (!rep_)
         blocked_ = false; // Return the default invalid slot.
     }
     else
@@ -149,7 +182,8 @@ slot_base::slot_base(slot_base&& src) : rep_(nullptr), blocked_(src.blocked_)
 
 slot_base::~slot_base()
 {
-  delete rep_;
+  if (!shared_rep_)
+    delete rep_;
 }
 
 slot_base::operator bool() const noexcept
@@ -163,6 +197,14 @@ slot_base::delete_rep_with_check()
   if (!rep_)
     return;
 
+  if (shared_rep_)
+  {
+    // Nothing is attached to a shared slot_rep.
+    rep_ = nullptr;
+    shared_rep_ = false;
+    return;
+  }
+
   // Make sure we are notified if disconnect() deletes rep_, which is trackable.
   // Compare slot_rep::notify_slot_rep_invalidated().
   sigc::internal::weak_raw_ptr<rep_type> notifier(rep_);
@@ -184,7 +226,7 @@ slot_base::operator=(const slot_base& src)
 {
   if (src.rep_ == rep_)
   {
-    blocked_ = src.blocked_;
+    block(src.blocked_);
     return *this;
   }
 
@@ -195,16 +237,29 @@ slot_base::operator=(const slot_base& src)
     return *this;
   }
 
+  if (src.shared_rep_ && !(rep_ && rep_->parent_))
+  {
+    // Share the slot_rep, unless this slot is connected to a parent.
+    if (!shared_rep_)
+      delete rep_; // Calls destroy(), but does not call disconnect().
+    rep_ = src.rep_;
+    shared_rep_ = true;
+    block(src.blocked_);
+    return *this;
+  }
+
   auto new_rep_ = src.rep_->clone();
 
   if (rep_) // Silently exchange the slot_rep.
   {
     new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
-    delete rep_; // Calls destroy(), but does not call disconnect().
+    if (!shared_rep_)
+      delete rep_; // Calls destroy(), but does not call disconnect().
   }
 
   rep_ = new_rep_;
-  blocked_ = src.blocked_;
+  shared_rep_ = false;
+  block(src.blocked_);
 
   return *this;
 }
@@ -214,7 +269,7 @@ slot_base::operator=(slot_base&& src)
 {
   if (src.rep_ == rep_)
   {
-    blocked_ = src.blocked_;
+    block(src.blocked_);
     return *this;
   }
 
@@ -224,7 +279,19 @@ slot_base::operator=(slot_base&& src)
     return *this;
   }
 
-  blocked_ = src.blocked_;
+  if (src.shared_rep_)
+  {
+    // Copying a shared slot_rep is as cheap as moving it.
+    operator=(static_cast<const slot_base&>(src));
+
+    // Wipe src:
+    src.rep_ = nullptr;
+    src.blocked_ = false;
+    src.shared_rep_ = false;
+    return *this;
+  }
+
+  const bool src_blocked = src.blocked_;
   internal::slot_rep* new_rep_ = nullptr;
   if (src.rep_->parent_)
   {
@@ -246,23 +313,38 @@ slot_base::operator=(slot_base&& src)
   if (rep_) // Silently exchange the slot_rep.
   {
     new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
-    delete rep_; // Calls destroy(), but does not call disconnect().
+    if (!shared_rep_)
+      delete rep_; // Calls destroy(), but does not call disconnect().
   }
   rep_ = new_rep_;
+  shared_rep_ = false;
+  block(src_blocked);
   return *this;
 }
 
 void
-slot_base::set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const noexcept
+slot_base::unshare_rep() const
+{
+  if (shared_rep_)
+  {
+    rep_ = rep_->clone();
+    shared_rep_ = false;
+  }
+}
+
+void
+slot_base::set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const
 {
   if (!rep_)
     rep_ = new dummy_slot_rep();
+  unshare_rep();
   rep_->set_parent(parent, cleanup);
 }
 
 void
 slot_base::add_destroy_notify_callback(notifiable* data, func_destroy_notify func) const
 {
+  unshare_rep();
   if (rep_)
     rep_->add_destroy_notify_callback(data, func);
 }
@@ -270,7 +352,8 @@ slot_base::add_destroy_notify_callback(notifiable* data, func_destroy_notify fun
 void
 slot_base::remove_destroy_notify_callback(notifiable* data) const
 {
-  if (rep_)
+  // Nothing is attached to a shared slot_rep.
+  if (rep_ && !shared_rep_)
     rep_->remove_destroy_notify_callback(data);
 }
 
@@ -279,6 +362,9 @@ slot_base::block(bool should_block) noexcept
 {
   bool old = blocked_;
   blocked_ = should_block;
+  // Keep the count of blocked slots up to date, if this slot is in a signal.
+  if (old != should_block && rep_)
+    internal::signal_impl::notify_slot_blocked(rep_, should_block);
   return old;
 }
 
@@ -291,6 +377,7 @@ slot_base::unblock() noexcept
 void
 slot_base::disconnect()
 {
+  unshare_rep();
   if (rep_)
     rep_->disconnect();
 }
@@ -87,6 +87,7 @@ public:
 
   /** Makes a deep copy of the slot_rep object.
    * @return A deep copy of the slot_rep object.
+   * @throw std::logic_error If the functor can't be copied.
    */
   virtual slot_rep* clone() const = 0;
 
@@ -277,6 +278,13 @@ public:
    */
   explicit slot_base(rep_type* rep) noexcept;
 
+  /** Constructs a slot from an existing slot_rep object, which it may share.
+   * @param rep The slot_rep object this slot should contain.
+   * @param shared Whether @p rep is a shared slot_rep, that the slot doesn't own.
+   * See shared_rep_.
+   */
+  slot_base(rep_type* rep, bool shared) noexcept;
+
   /** Constructs a slot, copying an existing one.
    * @param src The existing slot to copy.
    */
@@ -307,8 +315,10 @@ public:
    * because of some referred object dying.
    * @param parent The new parent.
    * @param cleanup The notification callback.
+   * @throw std::bad_alloc If the slot's shared slot_rep can't be copied.
+   *        The slot then has no parent.
    */
-  void set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const noexcept;
+  void set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const;
 
   /** Add a callback that is executed (notified) when the slot is destroyed.
    * This function is used internally by connection objects.
@@ -377,8 +387,19 @@ public: // public to avoid template friend declarations
   /** Indicates whether the slot is blocked. */
   bool blocked_;
 
+  /** Indicates whether rep_ is shared with other slots.
+   * A shared slot_rep holds a stateless functor. It's statically allocated,
+   * and it's never modified. Copying such a slot copies only the pointer.
+   * Before anything is attached to the slot_rep, such as a parent or a
+   * destroy notification callback, the slot replaces it with its own copy.
+   */
+  mutable bool shared_rep_;
+
 private:
   void delete_rep_with_check();
+
+  /// Replaces a shared rep_ with a copy that this slot owns.
+  void unshare_rep() const;
 };
 
 } // namespace sigc
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <sigc++/instrumentation.h>
+#include <sigc++/profiler.h>
+#include <sigc++/tracing.h>
+#include <sigc++/functors/slot_base.h>
+#include <cstdlib>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace sigc
+{
+namespace internal
+{
+
+std::atomic<unsigned> instrumentation_flags(0);
+
+const std::type_info&
+slot_rep_type(const slot_rep* rep) noexcept
+{
+  // typeid() of the polymorphic slot_rep yields the typed_slot_rep<T_functor>.
+  return typeid(*rep);
+}
+
+std::string
+slot_functor_name(const std::type_info& type)
+{
+  std::string name = type.name();
+#ifdef __GNUG__
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (demangled)
+  {
+    name = demangled;
+    std::free(demangled);
+  }
+#endif
+
+  // Strip the typed_slot_rep<> or stateless_slot_rep<> around the functor type.
+  for (const std::string rep_prefix :
+    { "sigc::internal::typed_slot_rep<", "sigc::internal::stateless_slot_rep<" })
+  {
+    if (name.compare(0, rep_prefix.size(), rep_prefix) == 0 && name.back() == '>')
+    {
+      name = name.substr(rep_prefix.size(), name.size() - rep_prefix.size() - 1);
+      while (!name.empty() && name.back() == ' ')
+        name.pop_back();
+      break;
+    }
+  }
+  return name;
+}
+
+slot_invocation_scope::slot_invocation_scope(const signal_impl* sig, const slot_rep* rep) noexcept
+: sig_(sig), rep_(rep), profile_type_(nullptr), profile_start_(0), traced_(false)
+{
+  const auto flags = instrumentation_flags.load(std::memory_order_relaxed);
+  if (flags & instrument_trace)
+    traced_ = trace_slot_begin(sig, rep, slot_rep_type(rep));
+
+  if ((flags & instrument_profile) && profiler_sample())
+  {
+    profile_type_ = &slot_rep_type(rep);
+    profile_start_ = profiler_now();
+  }
+}
+
+slot_invocation_scope::~slot_invocation_scope()
+{
+  if (profile_type_)
+    profiler_record(sig_, rep_, *profile_type_, profiler_now() - profile_start_);
+
+  if (traced_)
+    trace_slot_end(sig_, rep_);
+}
+
+} /* namespace internal */
+} /* namespace sigc */
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_INSTRUMENTATION_H
+#define SIGC_INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <sigc++config.h>
+#include <sigc++/type_traits.h>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+struct slot_rep;
+struct signal_impl;
+
+/** Bits in instrumentation_flags.
+ * Each bit is set while one kind of instrumentation is active.
+ */
+enum instrumentation_bits : unsigned
+{
+  /// Slot invocations are sampled by the profiler. See sigc::set_slot_profiling().
+  instrument_profile = 1u << 0,
+  /// Emissions and slot invocations are recorded as trace events. See sigc::start_tracing().
+  instrument_trace = 1u << 1,
+  /// Emissions of some signals are recorded. See sigc::emission_recorder.
+  instrument_record = 1u << 2
+};
+
+/** The currently active kinds of instrumentation.
+ * Signal emission and slot::operator()() read this once per slot invocation. When it's zero,
+ * which is the normal case, slots are invoked without any further overhead.
+ */
+extern SIGC_API std::atomic<unsigned> instrumentation_flags;
+
+/// Returns whether any kind of instrumentation is active.
+inline bool
+instrumentation_active() noexcept
+{
+  return instrumentation_flags.load(std::memory_order_relaxed) != 0;
+}
+
+/** Returns the dynamic type of a slot_rep.
+ * It must be determined before the slot is invoked, because the slot
+ * may be destroyed during its invocation.
+ * @param rep The slot_rep of a slot that is about to be invoked.
+ * @return The type of the typed_slot_rep or stateless_slot_rep.
+ */
+SIGC_API const std::type_info& slot_rep_type(const slot_rep* rep) noexcept;
+
+/** Returns a readable name of the functor type stored in a slot_rep.
+ * @param type The dynamic type of a slot_rep, from slot_rep_type().
+ * @return The demangled functor type, if the compiler supports demangling.
+ */
+SIGC_API std::string slot_functor_name(const std::type_info& type);
+
+/** Instruments the invocation of one slot during signal emission or
+ * in slot::operator()().
+ * Construct it immediately before the slot's functor is invoked.
+ * It is only constructed if instrumentation_active() returns @p true.
+ */
+struct SIGC_API slot_invocation_scope
+{
+  /** Starts instrumenting a slot invocation.
+   * @param sig The signal that invokes the slot, or nullptr if the slot is invoked directly.
+   * @param rep The slot_rep of the invoked slot.
+   */
+  slot_invocation_scope(const signal_impl* sig, const slot_rep* rep) noexcept;
+
+  slot_invocation_scope(const slot_invocation_scope& src) = delete;
+  slot_invocation_scope& operator=(const slot_invocation_scope& src) = delete;
+
+  slot_invocation_scope(slot_invocation_scope&& src) = delete;
+  slot_invocation_scope& operator=(slot_invocation_scope&& src) = delete;
+
+  /// Finishes instrumenting the slot invocation.
+  ~slot_invocation_scope();
+
+private:
+  const signal_impl* sig_;
+  const slot_rep* rep_;
+
+  /// The type of the sampled slot, or nullptr if this invocation is not sampled by the profiler.
+  const std::type_info* profile_type_;
+
+  /// Start time in nanoseconds, if this invocation is sampled by the profiler.
+  std::uint64_t profile_start_;
+
+  /// Whether the begin of this invocation has been recorded as a trace event.
+  bool traced_;
+};
+
+/// The type in which an emission argument of type @e T is recorded.
+template <typename T>
+using recorded_type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+/** Returns whether emissions with these argument types can be recorded.
+ * @return @p true if all arguments are trivially copyable.
+ */
+template <typename... T_arg>
+constexpr bool
+recordable_arguments()
+{
+  const bool recordable[] = { true, std::is_trivially_copyable<recorded_type<T_arg>>::value... };
+  for (const bool r : recordable)
+    if (!r)
+      return false;
+  return true;
+}
+
+/** Returns the offset of an argument in a recorded emission.
+ * The arguments are stored one after the other, without padding.
+ * @param index The index of the argument. The size of all arguments, if it's sizeof...(T_arg).
+ * @return The offset of the argument, in bytes.
+ */
+template <typename... T_arg>
+constexpr std::size_t
+recorded_offset(std::size_t index)
+{
+  const std::size_t sizes[] = { 0, sizeof(recorded_type<T_arg>)... };
+  std::size_t offset = 0;
+  for (std::size_t i = 1; i <= index; ++i)
+    offset += sizes[i];
+  return offset;
+}
+
+/** Records the arguments of an emission, if the signal is recorded.
+ * See sigc::emission_recorder.
+ * @param sig The emitting signal.
+ * @param payload The arguments, as stored by emission_payload.
+ * @param size The size of @a payload.
+ */
+SIGC_API void record_emission(const signal_impl* sig, const void* payload, std::size_t size) noexcept;
+
+/** Stops recording a signal, because it's being deleted.
+ * @param sig The deleted signal.
+ */
+SIGC_API void forget_recorded_signal(const signal_impl* sig) noexcept;
+
+/** Whether the profiler holds profiles that must be discarded when their slots are deleted.
+ * It's set when the first profile is created, and cleared by sigc::reset_slot_profiles().
+ */
+extern SIGC_API std::atomic<bool> slot_profiles_kept;
+
+/** Discards the profile of a slot, because it's being deleted.
+ * @param rep The deleted slot_rep.
+ */
+SIGC_API void forget_profiled_slot(const slot_rep* rep) noexcept;
+
+/** Called by the destructors of the slot_reps that can be invoked.
+ * @param rep The deleted slot_rep.
+ */
+inline void
+slot_rep_destroyed(const slot_rep* rep) noexcept
+{
+  if (slot_profiles_kept.load(std::memory_order_relaxed))
+    forget_profiled_slot(rep);
+}
+
+/** Copies the arguments of an emission into a buffer, for the emission recorder.
+ * Emissions with arguments that are not trivially copyable can't be recorded.
+ */
+template <bool I_recordable, typename... T_arg>
+struct emission_payload
+{
+  template <typename... T_value>
+  static void record(const signal_impl*, const T_value&...) noexcept
+  {
+  }
+};
+
+template <typename... T_arg>
+struct emission_payload<true, T_arg...>
+{
+  static void record(const signal_impl* sig, type_trait_take_t<T_arg>... a) noexcept
+  {
+    constexpr std::size_t size = recorded_offset<T_arg...>(sizeof...(T_arg));
+    if constexpr (size == 0)
+    {
+      // Nothing to copy.
+      record_emission(sig, nullptr, 0);
+    }
+    else
+    {
+      unsigned char payload[size];
+      std::size_t offset = 0;
+      const int expand[] = { 0,
+        (std::memcpy(payload + offset, std::addressof(a), sizeof(recorded_type<T_arg>)),
+          offset += sizeof(recorded_type<T_arg>), 0)... };
+      static_cast<void>(expand);
+      record_emission(sig, payload, size);
+    }
+  }
+};
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif /* SIGC_INSTRUMENTATION_H */
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_PROBES_H
+#define SIGC_PROBES_H
+
+#include <cstdint>
+#include <sigc++config.h>
+
+/** @defgroup probes Static Probes
+ * libsigc++ contains statically defined tracepoints (SDT probes, also known
+ * as USDT probes) in the same format as the probes defined with the
+ * DTRACE_PROBE() macros of SystemTap's sys/sdt.h. No external header is needed.
+ * A probe is a single @c nop instruction, plus a note in the
+ * @c .note.stapsdt section of the ELF file, describing where the probe
+ * and its arguments are. Tools such as perf, bpftrace and SystemTap can
+ * attach to the probes at run time.
+ *
+ * @code
+ * bpftrace -e 'usdt:./myprogram:libsigcxx:emit_begin { @slots = hist(arg1); }'
+ * @endcode
+ *
+ * All probes belong to the provider @c libsigcxx. Their arguments are
+ * 64-bit integers or addresses.
+ * - @c emit_begin (signal, number of slots): A signal emission starts.
+ * - @c emit_end (signal, number of slots): A signal emission ends.
+ * - @c slot_invoke (signal, slot, call hook): A slot is about to be invoked during emission.
+ *   The call hook is the address of the function that invokes the slot's functor.
+ * - @c slot_return (signal, slot): A slot invoked during emission has returned.
+ * - @c connect (signal, slot, number of slots): A slot has been connected to a signal.
+ * - @c disconnect (slot, parent): A slot has been disconnected.
+ * - @c sweep (signal, number of slots before, number of slots after):
+ *   Slots that were disconnected during emission have been removed.
+ *
+ * Since most of the probes are in inline functions, they are compiled into
+ * the programs that use libsigc++. Define @c SIGC_DISABLE_PROBES before
+ * including any libsigc++ header to omit them. The probes are only
+ * available with GCC or clang on ELF platforms on x86-64 and AArch64.
+ * Elsewhere the probe macros expand to nothing.
+ */
+
+#if !defined(SIGC_DISABLE_PROBES) && defined(__GNUC__) && defined(__ELF__) && \
+  (defined(__x86_64__) || defined(__aarch64__))
+#define SIGC_PROBES_ENABLED 1
+#endif
+
+#ifdef SIGC_PROBES_ENABLED
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+// The layout of the note follows SystemTap's sys/sdt.h, version 3.
+// The "?" section flag puts the note into the same COMDAT group as the
+// function that contains the probe, if any.
+#define SIGC_PROBE_ASM(name, args)                                   \
+  "990: nop\n"                                                       \
+  ".pushsection .note.stapsdt,\"?\",\"note\"\n"                      \
+  ".balign 4\n"                                                      \
+  ".4byte 992f-991f, 994f-993f, 3\n"                                 \
+  "991: .asciz \"stapsdt\"\n"                                        \
+  "992: .balign 4\n"                                                 \
+  "993: .8byte 990b\n"                                               \
+  ".8byte _.stapsdt.base\n"                                          \
+  ".8byte 0\n"                                                       \
+  ".asciz \"libsigcxx\"\n"                                           \
+  ".asciz \"" #name "\"\n"                                           \
+  ".asciz \"" args "\"\n"                                            \
+  "994: .balign 4\n"                                                 \
+  ".popsection\n"                                                    \
+  ".ifndef _.stapsdt.base\n"                                         \
+  ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+  ".weak _.stapsdt.base\n"                                           \
+  ".hidden _.stapsdt.base\n"                                         \
+  "_.stapsdt.base: .space 1\n"                                       \
+  ".size _.stapsdt.base, 1\n"                                        \
+  ".popsection\n"                                                    \
+  ".endif\n"
+
+#define SIGC_PROBE_ARG(a) "nor"((std::uint64_t)(a))
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// Fires a probe with two arguments.
+#define SIGC_PROBE2(name, a1, a2) \
+  __asm__ __volatile__(SIGC_PROBE_ASM(name, "8@%0 8@%1")::SIGC_PROBE_ARG(a1), SIGC_PROBE_ARG(a2))
+
+/// Fires a probe with three arguments.
+#define SIGC_PROBE3(name, a1, a2, a3)                     \
+  __asm__ __volatile__(SIGC_PROBE_ASM(name, "8@%0 8@%1 8@%2")::SIGC_PROBE_ARG(a1), \
+                       SIGC_PROBE_ARG(a2), SIGC_PROBE_ARG(a3))
+
+#else // SIGC_PROBES_ENABLED
+
+#define SIGC_PROBE2(name, a1, a2) ((void)(a1), (void)(a2))
+#define SIGC_PROBE3(name, a1, a2, a3) ((void)(a1), (void)(a2), (void)(a3))
+
+#endif // SIGC_PROBES_ENABLED
+
+#endif /* SIGC_PROBES_H */
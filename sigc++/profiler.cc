@@ -0,0 +1,200 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <sigc++/profiler.h>
+#include <sigc++/instrumentation.h>
+#include <sigc++/functors/slot_base.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace
+{
+// Sample every sampling_interval-th slot invocation in each thread.
+std::atomic<unsigned> sampling_interval;
+thread_local unsigned sampling_countdown = 0;
+
+struct profile_record
+{
+  const std::type_info* type;
+  sigc::slot_profile profile;
+};
+
+struct profile_map : public std::unordered_map<const sigc::internal::slot_rep*, profile_record>
+{
+  // Slots with static storage duration may be deleted after the map.
+  ~profile_map() { sigc::internal::slot_profiles_kept.store(false, std::memory_order_relaxed); }
+};
+
+std::mutex profiles_mutex;
+profile_map profiles;
+
+std::size_t
+histogram_bucket(std::uint64_t ns)
+{
+  std::size_t bucket = 0;
+  while (ns > 1 && bucket < sigc::slot_profile::histogram_buckets - 1)
+  {
+    ns >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+} // anonymous namespace
+
+namespace sigc
+{
+
+constexpr std::size_t slot_profile::histogram_buckets;
+
+double
+slot_profile::mean_ns() const noexcept
+{
+  return samples ? static_cast<double>(total_ns) / samples : 0.0;
+}
+
+std::uint64_t
+slot_profile::percentile_ns(double percentile) const noexcept
+{
+  if (!samples)
+    return 0;
+
+  const auto rank = static_cast<std::uint64_t>(std::ceil(samples * percentile / 100.0));
+  std::uint64_t seen = 0;
+  for (std::size_t i = 0; i < histogram_buckets - 1; ++i)
+  {
+    seen += histogram[i];
+    if (seen >= rank)
+      return std::min(max_ns, (std::uint64_t(2) << i) - 1);
+  }
+  return max_ns;
+}
+
+void
+set_slot_profiling(double fraction)
+{
+  unsigned interval = 0;
+  if (fraction >= 1.0)
+    interval = 1;
+  else if (fraction > 0.0)
+    interval = static_cast<unsigned>(std::min(std::lround(1.0 / fraction), 0xffffffffl));
+
+  sampling_interval.store(interval, std::memory_order_relaxed);
+  if (interval)
+    internal::instrumentation_flags.fetch_or(internal::instrument_profile);
+  else
+    internal::instrumentation_flags.fetch_and(~internal::instrument_profile);
+}
+
+std::vector<slot_profile>
+slot_profiles(std::size_t max_count)
+{
+  std::vector<slot_profile> result;
+  {
+    std::lock_guard<std::mutex> lock(profiles_mutex);
+    result.reserve(profiles.size());
+    for (const auto& entry : profiles)
+      result.push_back(entry.second.profile);
+  }
+
+  std::sort(result.begin(), result.end(), [](const slot_profile& a, const slot_profile& b) {
+    return a.mean_ns() > b.mean_ns();
+  });
+  if (max_count && result.size() > max_count)
+    result.resize(max_count);
+  return result;
+}
+
+void
+reset_slot_profiles()
+{
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  profiles.clear();
+  internal::slot_profiles_kept.store(false, std::memory_order_relaxed);
+}
+
+namespace internal
+{
+
+std::atomic<bool> slot_profiles_kept(false);
+
+void
+forget_profiled_slot(const slot_rep* rep) noexcept
+{
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  profiles.erase(rep);
+}
+
+bool
+profiler_sample() noexcept
+{
+  const auto interval = sampling_interval.load(std::memory_order_relaxed);
+  if (!interval)
+    return false;
+
+  if (sampling_countdown == 0 || sampling_countdown > interval)
+    sampling_countdown = interval;
+  return --sampling_countdown == 0;
+}
+
+std::uint64_t
+profiler_now() noexcept
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+void
+profiler_record(
+  const signal_impl* sig, const slot_rep* rep, const std::type_info& type, std::uint64_t ns) noexcept
+{
+  try
+  {
+    std::lock_guard<std::mutex> lock(profiles_mutex);
+    slot_profiles_kept.store(true, std::memory_order_relaxed);
+    auto& record = profiles[rep];
+    if (record.type != &type && (!record.type || *record.type != type))
+    {
+      // A new slot. Or a slot that was deleted during its invocation, and
+      // a new slot of another type at its address.
+      record = profile_record();
+      record.type = &type;
+      record.profile.slot = rep;
+      record.profile.functor_type = slot_functor_name(type);
+    }
+
+    auto& profile = record.profile;
+    profile.signal = sig;
+    ++profile.samples;
+    profile.total_ns += ns;
+    profile.max_ns = std::max(profile.max_ns, ns);
+    ++profile.histogram[histogram_bucket(ns)];
+  }
+  catch (...)
+  {
+    // Out of memory. Drop the sample.
+  }
+}
+
+} /* namespace internal */
+
+} /* namespace sigc */
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_PROFILER_H
+#define SIGC_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <sigc++config.h>
+
+namespace sigc
+{
+
+/** @defgroup profiler Profiler
+ * The slot profiler measures how long the slots take, that are invoked
+ * during signal emission or directly with slot::operator()(). It's
+ * switched off by default. When it's switched on, a configurable fraction
+ * of the slot invocations is timed, and the durations are collected in one
+ * histogram per slot.
+ *
+ * @code
+ * sigc::set_slot_profiling(0.01); // Time 1% of the slot invocations.
+ * run_application();
+ * for (const auto& p : sigc::slot_profiles(10))
+ *   std::cout << p.functor_type << ": " << p.mean_ns() << " ns" << std::endl;
+ * @endcode
+ *
+ * The slots are identified by the addresses of their internal
+ * representation, and labelled with the demangled type of the functor
+ * they contain. The profile of a slot is discarded when the slot is
+ * destroyed, so slot_profiles() only reports slots that are alive.
+ * Copy the profiles before the slots are destroyed, if you need them.
+ *
+ * The profiler can be used from several threads. The samples are collected
+ * under a mutex, which is only locked for sampled invocations.
+ */
+
+/** The sampled invocation times of one slot.
+ * Returned by sigc::slot_profiles().
+ *
+ * @ingroup profiler
+ */
+struct SIGC_API slot_profile
+{
+  /// Number of buckets in histogram.
+  static constexpr std::size_t histogram_buckets = 40;
+
+  /// Address of the slot's internal representation.
+  const void* slot;
+
+  /** Address of the internal representation of the signal that last invoked the slot.
+   * nullptr if the slot was last invoked directly with slot::operator()().
+   */
+  const void* signal;
+
+  /// The demangled type of the functor that the slot contains.
+  std::string functor_type;
+
+  /// Number of sampled invocations.
+  std::uint64_t samples;
+
+  /// Total time of the sampled invocations, in nanoseconds.
+  std::uint64_t total_ns;
+
+  /// Longest sampled invocation, in nanoseconds.
+  std::uint64_t max_ns;
+
+  /** Histogram of the sampled invocation times.
+   * histogram[0] counts invocations that took less than 2 ns.
+   * For i > 0, histogram[i] counts invocations that took at least 2^i ns
+   * and less than 2^(i+1) ns. The last bucket also counts all longer invocations.
+   */
+  std::uint64_t histogram[histogram_buckets];
+
+  /** Returns the mean invocation time.
+   * @return The mean of the sampled invocation times, in nanoseconds.
+   */
+  double mean_ns() const noexcept;
+
+  /** Estimates a percentile of the invocation times from the histogram.
+   * @param percentile A number between 0 and 100, e.g. 99.9.
+   * @return An upper bound of the requested percentile, in nanoseconds.
+   */
+  std::uint64_t percentile_ns(double percentile) const noexcept;
+};
+
+/** Switches the slot profiler on or off.
+ * @param fraction The fraction of the slot invocations that shall be timed.
+ *        0 switches the profiler off, 1 times all invocations.
+ *        Other values are rounded to an integral sampling interval,
+ *        e.g. 0.01 times every 100th invocation in each thread.
+ *
+ * @ingroup profiler
+ */
+SIGC_API void set_slot_profiling(double fraction);
+
+/** Returns the profiles of the slowest slots.
+ * The slots are sorted by their mean invocation time, slowest first.
+ * @param max_count The maximum number of profiles to return. 0 means all.
+ * @return The profiles of the slowest slots.
+ *
+ * @ingroup profiler
+ */
+SIGC_API std::vector<slot_profile> slot_profiles(std::size_t max_count = 0);
+
+/** Discards all collected profiles.
+ * Does not switch the profiler on or off.
+ *
+ * @ingroup profiler
+ */
+SIGC_API void reset_slot_profiles();
+
+namespace internal
+{
+
+struct slot_rep;
+struct signal_impl;
+
+/** Decides whether the current slot invocation shall be timed.
+ * @return @p true for every n-th call in each thread, as set by set_slot_profiling().
+ */
+SIGC_API bool profiler_sample() noexcept;
+
+/** Reads the profiler's clock.
+ * @return The current time in nanoseconds.
+ */
+SIGC_API std::uint64_t profiler_now() noexcept;
+
+/** Adds a sampled invocation time to a slot's profile.
+ * @param sig The signal that invoked the slot, or nullptr.
+ * @param rep The slot_rep of the invoked slot.
+ * @param type The dynamic type of @a rep, from slot_rep_type().
+ * @param ns The invocation time in nanoseconds.
+ */
+SIGC_API void profiler_record(
+  const signal_impl* sig, const slot_rep* rep, const std::type_info& type, std::uint64_t ns) noexcept;
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif /* SIGC_PROFILER_H */
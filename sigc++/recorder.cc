@@ -0,0 +1,566 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <sigc++/recorder.h>
+#include <sigc++/instrumentation.h>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SIGC_RECORDER_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+const char log_magic[8] = "sigcrec";
+const std::uint32_t log_version = 2;
+const std::uint32_t definition_channel = 0xffffffff;
+
+struct log_header
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t reserved;
+  std::uint64_t committed; // The size of the log up to the end of the last complete record.
+};
+
+struct record_header
+{
+  std::uint32_t channel;
+  std::uint32_t size;
+  std::uint64_t ns;
+};
+
+std::size_t
+padded(std::size_t size)
+{
+  return (size + 7) & ~std::size_t(7);
+}
+
+[[noreturn]] void
+throw_errno(const std::string& what)
+{
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+// Appends records to a log file.
+class log_writer
+{
+public:
+  explicit log_writer(const std::string& filename);
+  ~log_writer();
+
+  log_writer(const log_writer&) = delete;
+  log_writer& operator=(const log_writer&) = delete;
+
+  // Appends a record whose payload consists of two parts.
+  bool append(std::uint32_t channel, std::uint64_t ns, const void* data1, std::size_t size1,
+    const void* data2 = nullptr, std::size_t size2 = 0) noexcept;
+
+private:
+#ifdef SIGC_RECORDER_MMAP
+  bool reserve(std::size_t size) noexcept;
+
+  int fd_;
+  unsigned char* data_;
+  std::size_t capacity_;
+  std::size_t size_;
+#else
+  std::FILE* file_;
+  std::size_t size_;
+#endif
+};
+
+#ifdef SIGC_RECORDER_MMAP
+
+log_writer::log_writer(const std::string& filename)
+: fd_(::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)),
+  data_(nullptr),
+  capacity_(0),
+  size_(0)
+{
+  if (fd_ < 0)
+    throw_errno("Can't create " + filename);
+
+  log_header header = {};
+  std::memcpy(header.magic, log_magic, sizeof(log_magic));
+  header.version = log_version;
+  header.committed = sizeof(header);
+  if (!reserve(sizeof(header)))
+  {
+    const int error = errno;
+    ::close(fd_);
+    errno = error;
+    throw_errno("Can't map " + filename);
+  }
+  std::memcpy(data_, &header, sizeof(header));
+  size_ = sizeof(header);
+}
+
+log_writer::~log_writer()
+{
+  if (data_)
+    ::munmap(data_, capacity_);
+  // Cut off the unused part of the mapping.
+  if (::ftruncate(fd_, size_) != 0)
+    std::perror("sigc::emission_recorder");
+  ::close(fd_);
+}
+
+bool
+log_writer::reserve(std::size_t size) noexcept
+{
+  if (size_ + size <= capacity_)
+    return true;
+
+  std::size_t capacity = capacity_ ? capacity_ : 1 << 20;
+  while (capacity < size_ + size)
+    capacity *= 2;
+
+  if (::ftruncate(fd_, capacity) != 0)
+    return false;
+  void* data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (data == MAP_FAILED)
+    return false;
+
+  if (data_)
+    ::munmap(data_, capacity_);
+  data_ = static_cast<unsigned char*>(data);
+  capacity_ = capacity;
+  return true;
+}
+
+bool
+log_writer::append(std::uint32_t channel, std::uint64_t ns, const void* data1, std::size_t size1,
+  const void* data2, std::size_t size2) noexcept
+{
+  const record_header header = { channel, static_cast<std::uint32_t>(size1 + size2), ns };
+  const auto record_size = padded(sizeof(header) + size1 + size2);
+  if (!reserve(record_size))
+    return false;
+
+  auto p = data_ + size_;
+  std::memcpy(p, &header, sizeof(header));
+  if (size1)
+    std::memcpy(p + sizeof(header), data1, size1);
+  if (size2)
+    std::memcpy(p + sizeof(header) + size1, data2, size2);
+  std::memset(p + sizeof(header) + size1 + size2, 0, record_size - sizeof(header) - size1 - size2);
+  size_ += record_size;
+
+  // The file is extended in large steps, and the rest of it is zero-filled.
+  // If the process crashes, a reader trusts only the committed size, which
+  // is written after the record.
+  const std::uint64_t committed = size_;
+  std::atomic_signal_fence(std::memory_order_release);
+  std::memcpy(data_ + offsetof(log_header, committed), &committed, sizeof(committed));
+  return true;
+}
+
+#else // SIGC_RECORDER_MMAP
+
+log_writer::log_writer(const std::string& filename)
+: file_(std::fopen(filename.c_str(), "wb")), size_(sizeof(log_header))
+{
+  if (!file_)
+    throw_errno("Can't create " + filename);
+
+  log_header header = {};
+  std::memcpy(header.magic, log_magic, sizeof(log_magic));
+  header.version = log_version;
+  header.committed = size_;
+  std::fwrite(&header, sizeof(header), 1, file_);
+}
+
+log_writer::~log_writer()
+{
+  // The committed size is only written when the log is closed.
+  const std::uint64_t committed = size_;
+  if (std::fseek(file_, offsetof(log_header, committed), SEEK_SET) == 0)
+    std::fwrite(&committed, sizeof(committed), 1, file_);
+  std::fclose(file_);
+}
+
+bool
+log_writer::append(std::uint32_t channel, std::uint64_t ns, const void* data1, std::size_t size1,
+  const void* data2, std::size_t size2) noexcept
+{
+  static const unsigned char padding[8] = {};
+  const record_header header = { channel, static_cast<std::uint32_t>(size1 + size2), ns };
+  const auto size = sizeof(header) + size1 + size2;
+  if (std::fwrite(&header, sizeof(header), 1, file_) == 1 &&
+      (!size1 || std::fwrite(data1, size1, 1, file_) == 1) &&
+      (!size2 || std::fwrite(data2, size2, 1, file_) == 1) &&
+      (padded(size) == size || std::fwrite(padding, padded(size) - size, 1, file_) == 1))
+  {
+    size_ += padded(size);
+    return true;
+  }
+
+  // Overwrite the incomplete record with the next one.
+  std::fseek(file_, static_cast<long>(size_), SEEK_SET);
+  return false;
+}
+
+#endif // SIGC_RECORDER_MMAP
+
+#ifdef SIGC_RECORDER_MMAP
+
+// Closes a file descriptor when it goes out of scope.
+struct file_descriptor
+{
+  explicit file_descriptor(int f) : fd(f) {}
+  ~file_descriptor()
+  {
+    if (fd >= 0)
+      ::close(fd);
+  }
+
+  file_descriptor(const file_descriptor&) = delete;
+  file_descriptor& operator=(const file_descriptor&) = delete;
+
+  const int fd;
+};
+
+// Unmaps a memory mapping when it's destroyed.
+struct file_mapping
+{
+  file_mapping() = default;
+  ~file_mapping()
+  {
+    if (address)
+      ::munmap(address, length);
+  }
+
+  file_mapping(const file_mapping&) = delete;
+  file_mapping& operator=(const file_mapping&) = delete;
+
+  void* address = nullptr;
+  std::size_t length = 0;
+};
+
+#endif // SIGC_RECORDER_MMAP
+
+std::uint64_t
+now_ns() noexcept
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+// The log of an emission_recorder.
+struct recording
+{
+  explicit recording(const std::string& filename) : writer(filename), start_ns(now_ns()), emissions(0)
+  {
+  }
+
+  log_writer writer;
+  const std::uint64_t start_ns;
+  std::uint64_t emissions;
+
+  // The signature of each channel.
+  std::unordered_map<std::uint32_t, std::string> signatures;
+};
+
+} // anonymous namespace
+
+namespace sigc
+{
+
+struct emission_recorder::log : public recording
+{
+  using recording::recording;
+};
+
+namespace
+{
+
+struct recorded_signal
+{
+  recording* log;
+  std::uint32_t channel;
+};
+
+// All recorded signals of all recorders, and the recorders' logs, are guarded by recorder_mutex.
+std::mutex recorder_mutex;
+std::unordered_map<internal::signal_impl*, recorded_signal> recorded_signals;
+
+// Must be called with recorder_mutex locked.
+void
+update_record_flag()
+{
+  if (recorded_signals.empty())
+    internal::instrumentation_flags.fetch_and(~internal::instrument_record);
+  else
+    internal::instrumentation_flags.fetch_or(internal::instrument_record);
+}
+
+} // anonymous namespace
+
+emission_recorder::emission_recorder(const std::string& filename) : log_(new log(filename))
+{
+}
+
+emission_recorder::~emission_recorder()
+{
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  for (auto it = recorded_signals.begin(); it != recorded_signals.end();)
+  {
+    if (it->second.log == log_.get())
+    {
+      it->first->set_recorded(false);
+      it = recorded_signals.erase(it);
+    }
+    else
+      ++it;
+  }
+  update_record_flag();
+}
+
+void
+emission_recorder::add_signal(internal::signal_impl* sig, std::uint32_t channel,
+  const char* signature, std::size_t payload_size)
+{
+  if (channel == definition_channel)
+    throw std::invalid_argument("sigc::emission_recorder::add(): invalid channel");
+
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  const auto inserted = log_->signatures.emplace(channel, signature);
+  if (!inserted.second)
+  {
+    if (inserted.first->second != signature)
+      throw std::invalid_argument(
+        "sigc::emission_recorder::add(): channel used for a signal with other argument types");
+  }
+  else
+  {
+    const std::uint32_t definition[2] = { channel, static_cast<std::uint32_t>(payload_size) };
+    log_->writer.append(definition_channel, now_ns() - log_->start_ns, definition,
+      sizeof(definition), signature, std::strlen(signature));
+  }
+
+  recorded_signals[sig] = { log_.get(), channel };
+  sig->set_recorded(true);
+  update_record_flag();
+}
+
+void
+emission_recorder::remove(const signal_base& sig)
+{
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  const auto it = recorded_signals.find(sig.impl_.get());
+  if (it != recorded_signals.end() && it->second.log == log_.get())
+  {
+    it->first->set_recorded(false);
+    recorded_signals.erase(it);
+  }
+  update_record_flag();
+}
+
+std::uint64_t
+emission_recorder::emissions() const
+{
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  return log_->emissions;
+}
+
+namespace internal
+{
+
+void
+record_emission(const signal_impl* sig, const void* payload, std::size_t size) noexcept
+{
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  const auto it = recorded_signals.find(const_cast<signal_impl*>(sig));
+  if (it == recorded_signals.end())
+    return;
+
+  auto log = it->second.log;
+  if (log->writer.append(it->second.channel, now_ns() - log->start_ns, payload, size))
+    ++log->emissions;
+}
+
+void
+forget_recorded_signal(const signal_impl* sig) noexcept
+{
+  std::lock_guard<std::mutex> lock(recorder_mutex);
+  recorded_signals.erase(const_cast<signal_impl*>(sig));
+  update_record_flag();
+}
+
+} /* namespace internal */
+
+struct emission_player::log
+{
+  explicit log(const std::string& filename);
+
+  log(const log&) = delete;
+  log& operator=(const log&) = delete;
+
+  const unsigned char* data;
+  std::size_t size;
+
+#ifdef SIGC_RECORDER_MMAP
+  file_mapping mapping;
+#else
+  std::vector<unsigned char> contents;
+#endif
+
+  struct channel_info
+  {
+    std::string signature;
+    std::size_t payload_size;
+    emitter emit;
+  };
+  std::unordered_map<std::uint32_t, channel_info> channels;
+};
+
+emission_player::log::log(const std::string& filename)
+{
+#ifdef SIGC_RECORDER_MMAP
+  const file_descriptor file(::open(filename.c_str(), O_RDONLY | O_CLOEXEC));
+  if (file.fd < 0)
+    throw_errno("Can't open " + filename);
+
+  struct stat st;
+  if (::fstat(file.fd, &st) != 0)
+    throw_errno("Can't open " + filename);
+  size = static_cast<std::size_t>(st.st_size);
+  if (size)
+  {
+    void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.fd, 0);
+    if (address == MAP_FAILED)
+      throw_errno("Can't map " + filename);
+    mapping.address = address;
+    mapping.length = size;
+  }
+  data = static_cast<const unsigned char*>(mapping.address);
+#else
+  const std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(
+    std::fopen(filename.c_str(), "rb"), &std::fclose);
+  if (!file)
+    throw_errno("Can't open " + filename);
+  unsigned char buffer[4096];
+  std::size_t n;
+  while ((n = std::fread(buffer, 1, sizeof(buffer), file.get())) > 0)
+    contents.insert(contents.end(), buffer, buffer + n);
+  data = contents.data();
+  size = contents.size();
+#endif
+
+  // Validate the log, and collect the channel definitions.
+  const std::string invalid = filename + " is not a valid emission log";
+  log_header header;
+  if (size < sizeof(header))
+    throw std::runtime_error(invalid);
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, log_magic, sizeof(log_magic)) != 0 || header.version != log_version)
+    throw std::runtime_error(invalid);
+
+  // Anything after the committed size was not completely written.
+  if (header.committed < sizeof(header) || header.committed > size)
+    throw std::runtime_error(invalid);
+  size = static_cast<std::size_t>(header.committed);
+
+  for (std::size_t offset = sizeof(header); offset < size;)
+  {
+    record_header record;
+    if (size - offset < sizeof(record))
+      throw std::runtime_error(invalid);
+    std::memcpy(&record, data + offset, sizeof(record));
+    const auto payload = data + offset + sizeof(record);
+    if (size - offset - sizeof(record) < record.size)
+      throw std::runtime_error(invalid);
+
+    if (record.channel == definition_channel)
+    {
+      std::uint32_t definition[2];
+      if (record.size < sizeof(definition))
+        throw std::runtime_error(invalid);
+      std::memcpy(definition, payload, sizeof(definition));
+      auto& channel = channels[definition[0]];
+      channel.signature.assign(reinterpret_cast<const char*>(payload) + sizeof(definition),
+        record.size - sizeof(definition));
+      channel.payload_size = definition[1];
+    }
+    else
+    {
+      const auto channel = channels.find(record.channel);
+      if (channel == channels.end() || channel->second.payload_size != record.size)
+        throw std::runtime_error(invalid);
+    }
+    offset += padded(sizeof(record) + record.size);
+  }
+}
+
+emission_player::emission_player(const std::string& filename) : log_(new log(filename))
+{
+}
+
+emission_player::~emission_player() = default;
+
+void
+emission_player::bind_channel(
+  std::uint32_t channel, const char* signature, std::size_t payload_size, emitter&& emit)
+{
+  const auto it = log_->channels.find(channel);
+  if (it == log_->channels.end())
+    throw std::invalid_argument("sigc::emission_player::bind(): unknown channel");
+  if (it->second.signature != signature || it->second.payload_size != payload_size)
+    throw std::invalid_argument(
+      "sigc::emission_player::bind(): the recorded signal has other argument types");
+  it->second.emit = std::move(emit);
+}
+
+std::size_t
+emission_player::play()
+{
+  std::size_t count = 0;
+  const auto data = log_->data;
+  for (std::size_t offset = sizeof(log_header); offset < log_->size;)
+  {
+    record_header record;
+    std::memcpy(&record, data + offset, sizeof(record));
+    if (record.channel != definition_channel)
+    {
+      const auto& emit = log_->channels[record.channel].emit;
+      if (emit)
+      {
+        emit(data + offset + sizeof(record));
+        ++count;
+      }
+    }
+    offset += padded(sizeof(record) + record.size);
+  }
+  return count;
+}
+
+} /* namespace sigc */
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_RECORDER_H
+#define SIGC_RECORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <sigc++/signal.h>
+
+namespace sigc
+{
+
+/** @defgroup recorder Emission Recorder
+ * An emission_recorder records the emissions of selected signals, with
+ * their arguments, into a binary log file. An emission_player reads the
+ * log and re-emits the recorded emissions at full speed, e.g. on signals
+ * in a benchmark program that are connected to the same slots as the
+ * signals of the recorded application.
+ *
+ * @code
+ * // In the application:
+ * sigc::emission_recorder recorder("session.sigclog");
+ * recorder.add(window.signal_resize, 1);
+ * recorder.add(model.signal_row_changed, 2);
+ *
+ * // In the benchmark:
+ * sigc::emission_player player("session.sigclog");
+ * player.bind(1, benchmark_window.signal_resize);
+ * player.bind(2, benchmark_model.signal_row_changed);
+ * player.play();
+ * @endcode
+ *
+ * Only signals whose argument types are trivially copyable (after removing
+ * references and cv-qualifiers) can be recorded. The arguments are stored
+ * byte by byte, so pointers in the arguments are meaningless when the log
+ * is played.
+ *
+ * The log file is written and read through a memory mapping, if the
+ * platform supports it. Its format is native to the recording machine:
+ * - A header of 24 bytes: the magic string "sigcrec" with a terminating
+ *   null byte, the format version (uint32, currently 2), a reserved uint32,
+ *   and the committed size (uint64). The committed size is the size of the
+ *   log up to the end of the last complete record. Anything after it is
+ *   ignored, e.g. the zero-filled rest of the file of a recorder that crashed.
+ * - A sequence of records, each aligned to 8 bytes. A record starts with
+ *   the channel (uint32), the size of the payload (uint32), and the time
+ *   since the recorder was created, in nanoseconds (uint64).
+ *   The payload follows. In an emission record, the payload contains the
+ *   arguments one after the other, without padding. A channel of 0xffffffff
+ *   marks a channel definition record, whose payload contains the defined
+ *   channel (uint32), the size of its emission payloads (uint32), and the
+ *   mangled signature of the signal, without a terminating null byte.
+ *
+ * Emissions of recorded signals are serialized with a mutex. Emissions of
+ * other signals don't lock it, even while a recorder is active.
+ */
+
+/** Records the emissions of selected signals into a binary log file.
+ * Recording stops when the emission_recorder is destroyed.
+ *
+ * @ingroup recorder
+ */
+class SIGC_API emission_recorder
+{
+public:
+  /** Creates a log file and starts recording.
+   * An existing file is overwritten.
+   * @param filename The name of the log file.
+   * @throw std::system_error If the file can't be created.
+   */
+  explicit emission_recorder(const std::string& filename);
+
+  emission_recorder(const emission_recorder& src) = delete;
+  emission_recorder& operator=(const emission_recorder& src) = delete;
+
+  emission_recorder(emission_recorder&& src) = delete;
+  emission_recorder& operator=(emission_recorder&& src) = delete;
+
+  /// Stops recording and closes the log file.
+  ~emission_recorder();
+
+  /** Starts recording the emissions of a signal.
+   * Copies of @a sig share its slots, and their emissions are recorded too.
+   * A signal can be recorded by only one recorder at a time.
+   * @param sig The signal whose emissions shall be recorded.
+   * @param channel An identifier of the signal in the log, less than 0xffffffff.
+   * @throw std::invalid_argument If @a channel is 0xffffffff, or if it has been
+   *        used for a signal with other argument types.
+   */
+  template <typename T_return, typename T_accumulator, typename... T_arg>
+  void add(const signal_with_accumulator<T_return, T_accumulator, T_arg...>& sig,
+    std::uint32_t channel)
+  {
+    static_assert(internal::recordable_arguments<T_arg...>(),
+      "Only signals with trivially copyable argument types can be recorded.");
+    add_signal(sig.impl().get(), channel, typeid(void(internal::recorded_type<T_arg>...)).name(),
+      internal::recorded_offset<T_arg...>(sizeof...(T_arg)));
+  }
+
+  /** Stops recording the emissions of a signal.
+   * @param sig A signal that has been added with add().
+   */
+  void remove(const signal_base& sig);
+
+  /** Returns the number of recorded emissions.
+   * @return The number of emissions that have been written to the log.
+   */
+  std::uint64_t emissions() const;
+
+private:
+  void add_signal(internal::signal_impl* sig, std::uint32_t channel, const char* signature,
+    std::size_t payload_size);
+
+  struct log;
+  std::unique_ptr<log> log_;
+};
+
+/** Plays a log that has been written by an emission_recorder.
+ * The recorded channels are bound to signals with the same argument types,
+ * and play() emits them with the recorded arguments.
+ *
+ * @ingroup recorder
+ */
+class SIGC_API emission_player
+{
+public:
+  /** Opens a log file.
+   * @param filename The name of the log file.
+   * @throw std::system_error If the file can't be read.
+   * @throw std::runtime_error If the file is not a valid log.
+   */
+  explicit emission_player(const std::string& filename);
+
+  emission_player(const emission_player& src) = delete;
+  emission_player& operator=(const emission_player& src) = delete;
+
+  emission_player(emission_player&& src) = delete;
+  emission_player& operator=(emission_player&& src) = delete;
+
+  ~emission_player();
+
+  /** Binds a recorded channel to a signal.
+   * The signal must outlive the emission_player, or be unbound by
+   * binding another signal to the same channel.
+   * @param channel A channel in the log.
+   * @param sig The signal that shall be emitted for the channel's recorded emissions.
+   * @throw std::invalid_argument If the channel does not exist in the log,
+   *        or if its recorded signal has other argument types than @a sig.
+   */
+  template <typename T_return, typename T_accumulator, typename... T_arg>
+  void bind(std::uint32_t channel, const signal_with_accumulator<T_return, T_accumulator, T_arg...>& sig)
+  {
+    using signal_type = signal_with_accumulator<T_return, T_accumulator, T_arg...>;
+    static_assert(internal::recordable_arguments<T_arg...>(),
+      "Only signals with trivially copyable argument types can be played.");
+
+    const signal_type* psig = &sig;
+    bind_channel(channel, typeid(void(internal::recorded_type<T_arg>...)).name(),
+      internal::recorded_offset<T_arg...>(sizeof...(T_arg)), [psig](const unsigned char* payload) {
+        emit<signal_type, T_arg...>(*psig, payload, std::index_sequence_for<T_arg...>());
+      });
+  }
+
+  /** Emits all recorded emissions of the bound channels, in the recorded order.
+   * Emissions of unbound channels are skipped. The recorded timing is ignored.
+   * play() can be called several times.
+   * @return The number of emissions.
+   */
+  std::size_t play();
+
+private:
+  using emitter = std::function<void(const unsigned char* payload)>;
+
+  void bind_channel(
+    std::uint32_t channel, const char* signature, std::size_t payload_size, emitter&& emit);
+
+  template <typename T_signal, typename... T_arg, std::size_t... Is>
+  static void emit(const T_signal& sig, const unsigned char* payload, std::index_sequence<Is...>)
+  {
+    // Copy the arguments to correctly aligned storage.
+    std::tuple<std::aligned_storage_t<sizeof(internal::recorded_type<T_arg>),
+      alignof(internal::recorded_type<T_arg>)>...>
+      args;
+    const int expand[] = { 0, (std::memcpy(&std::get<Is>(args),
+                                 payload + internal::recorded_offset<T_arg...>(Is),
+                                 sizeof(internal::recorded_type<T_arg>)),
+                                0)... };
+    static_cast<void>(expand);
+    static_cast<void>(payload); // Unused if there are no arguments.
+    sig.emit(*reinterpret_cast<internal::recorded_type<T_arg>*>(&std::get<Is>(args))...);
+  }
+
+  struct log;
+  std::unique_ptr<log> log_;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_RECORDER_H */
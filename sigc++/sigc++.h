@@ -98,6 +98,7 @@
  */
 
 #include <sigc++/signal.h>
+#include <sigc++/static_signal.h>
 #include <sigc++/connection.h>
 #include <sigc++/trackable.h>
 #include <sigc++/adaptors/adaptors.h>
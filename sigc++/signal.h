@@ -22,6 +22,9 @@
 
 #include <list>
 #include <sigc++/connection.h>
+#include <sigc++/instrumentation.h>
+#include <sigc++/probes.h>
+#include <sigc++/tracing.h>
 #include <sigc++/signal_base.h>
 #include <sigc++/type_traits.h>
 #include <sigc++/trackable.h>
@@ -36,6 +39,72 @@ namespace sigc
 namespace internal
 {
 
+/// Fires the slot_return probe (see sigc++/probes.h) on destruction.
+struct slot_return_probe
+{
+  inline slot_return_probe(const signal_impl* sig, const slot_rep* rep) noexcept
+  : sig_(sig), rep_(rep)
+  {
+  }
+
+  inline ~slot_return_probe() { SIGC_PROBE2(slot_return, sig_, rep_); }
+
+  const signal_impl* sig_;
+  const slot_rep* rep_;
+};
+
+/** Marks the begin and end of a signal emission.
+ * Fires the emit_begin and emit_end probes (see sigc++/probes.h), and
+ * records trace events while tracing is on (see sigc++/tracing.h).
+ */
+struct emission_scope
+{
+  inline explicit emission_scope(const signal_impl* sig) noexcept
+  : sig_(sig),
+    traced_((instrumentation_flags.load(std::memory_order_relaxed) & instrument_trace) &&
+            trace_emission_begin(sig))
+  {
+    SIGC_PROBE2(emit_begin, sig_, sig_->slots_.size());
+  }
+
+  inline ~emission_scope()
+  {
+    SIGC_PROBE2(emit_end, sig_, sig_->slots_.size());
+    if (traced_)
+      trace_emission_end(sig_);
+  }
+
+  const signal_impl* sig_;
+  const bool traced_;
+};
+
+/** Invokes the functor of a slot during signal emission.
+ * All kinds of signal emission invoke slots via this function, so that the
+ * instrumentation described in sigc++/instrumentation.h sees each invocation.
+ * The slot must be neither empty nor blocked.
+ * @param sig The emitting signal.
+ * @param slot The slot to invoke.
+ * @param may_move Whether the slot may move the arguments (see signal::emit_move()).
+ * @param a Arguments to be passed on to the slot's functor.
+ * @return The return value of the functor invocation.
+ */
+template <typename T_return, typename... T_arg>
+inline T_return
+invoke_slot(
+  const signal_impl* sig, const slot_base& slot, bool may_move, type_trait_take_t<T_arg>... a)
+{
+  SIGC_PROBE3(slot_invoke, sig, slot.rep_, slot.rep_->call_);
+  const slot_return_probe probe(sig, slot.rep_);
+
+  if (!instrumentation_active())
+    return call_slot_rep<T_return, T_arg...>(
+      slot.rep_, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+
+  slot_invocation_scope scope(sig, slot.rep_);
+  return call_slot_rep<T_return, T_arg...>(
+    slot.rep_, may_move, std::forward<type_trait_take_t<T_arg>>(a)...);
+}
+
 /** Special iterator over sigc::internal::signal_impl's slot list that holds extra data.
  * This iterators is for use in accumulators. operator*() executes
  * the slot. The return value is buffered, so that in an expression
@@ -67,9 +136,12 @@ struct slot_iterator_buf
 
   decltype(auto) operator*() const
   {
-    if (!i_->empty() && !i_->blocked() && !invoked_)
+    if (!invoked_)
     {
-      r_ = (*c_)(static_cast<const slot_type&>(*i_));
+      if (!i_->blocked() && !i_->empty())
+        r_ = (*c_)(static_cast<const slot_type&>(*i_));
+      else
+        r_ = T_result(); // Blocked and empty slots yield a default value.
       invoked_ = true;
     }
     return r_;
@@ -144,7 +216,7 @@ struct slot_iterator_buf<T_emitter, void>
 
   void operator*() const
   {
-    if (!i_->empty() && !i_->blocked() && !invoked_)
+    if (!i_->blocked() && !i_->empty() && !invoked_)
     {
       (*c_)(static_cast<const slot_type&>(*i_));
       invoked_ = true;
@@ -217,6 +289,18 @@ struct temp_slot_list
   const_iterator begin() const { return slots_.begin(); }
   const_iterator end() const { return placeholder; }
 
+  /// Returns the last slot that is neither blocked nor empty, or end().
+  const_iterator last_unblocked() const
+  {
+    for (const_iterator it = placeholder; it != slots_.begin();)
+    {
+      --it;
+      if (!it->blocked() && !it->empty())
+        return it;
+    }
+    return placeholder;
+  }
+
 private:
   slot_list& slots_;
   slot_list::iterator placeholder;
@@ -238,7 +322,10 @@ struct signal_emit
    * The parameters are stored in member variables. operator()() passes
    * the values on to some slot.
    */
-  explicit signal_emit(type_trait_take_t<T_arg>... a) : a_(a...) {}
+  explicit signal_emit(const signal_impl* sig, type_trait_take_t<T_arg>... a)
+  : sig_(sig), a_(std::forward<type_trait_take_t<T_arg>>(a)...)
+  {
+  }
 
   /** Invokes a slot using the buffered parameter values.
    * @param slot Some slot to invoke.
@@ -252,9 +339,11 @@ struct signal_emit
 
   /** Executes a list of slots using an accumulator of type @e T_accumulator.
    * The arguments are buffered in a temporary instance of signal_emit.
+   * No slot moves the arguments, even if @e I_move is @p true.
    * @param a Arguments to be passed on to the slots.
    * @return The accumulated return values of the slot invocations as processed by the accumulator.
    */
+  template <bool I_move = false>
   static decltype(auto) emit(const std::shared_ptr<internal::signal_impl>& impl, type_trait_take_t<T_arg>... a)
   {
     using slot_iterator_buf_type = internal::slot_iterator_buf<self_type, T_return>;
@@ -265,23 +354,27 @@ struct signal_emit
       return accumulator(slot_iterator_buf_type(), slot_iterator_buf_type());
 
     signal_impl_holder exec(impl);
+    const emission_scope scope(impl.get());
     const temp_slot_list slots(impl->slots_);
 
-    self_type self(a...);
+    self_type self(impl.get(), std::forward<type_trait_take_t<T_arg>>(a)...);
     return accumulator(
       slot_iterator_buf_type(slots.begin(), &self), slot_iterator_buf_type(slots.end(), &self));
   }
 
 private:
+  const signal_impl* sig_;
   std::tuple<type_trait_take_t<T_arg>...> a_;
 
   // TODO_variadic: Replace this with std::experimental::apply() if that becomes standard
   // C++, or add our own implementation, to avoid code duplication.
   template <std::size_t... Is>
   decltype(auto) call_call_type_operator_parentheses_with_tuple(
-    const slot_type& slot, const std::tuple<T_arg...>& tuple, std::index_sequence<Is...>) const
+    const slot_type& slot, const std::tuple<type_trait_take_t<T_arg>...>& tuple,
+    std::index_sequence<Is...>) const
   {
-    return (slot)(std::get<Is>(tuple)...);
+    return invoke_slot<T_return, T_arg...>(
+      sig_, slot, false, static_cast<type_trait_take_t<T_arg>>(std::get<Is>(tuple))...);
   }
 };
 
@@ -292,26 +385,24 @@ private:
 template <typename T_return, typename... T_arg>
 struct signal_emit<T_return, void, T_arg...>
 {
-private:
-  using slot_type = slot<T_return(T_arg...)>;
-  using call_type = typename slot_type::call_type;
-
-public:
-
   /** Executes a list of slots.
    * The arguments are passed directly on to the slots.
    * The return value of the last slot invoked is returned.
+   * If @e I_move is @p true, the last slot may move the arguments.
    * @param first An iterator pointing to the first slot in the list.
    * @param last An iterator pointing to the last slot in the list.
    * @param a Arguments to be passed on to the slots.
    * @return The return value of the last slot invoked.
    */
+  template <bool I_move = false>
   static decltype(auto) emit(const std::shared_ptr<internal::signal_impl>& impl, type_trait_take_t<T_arg>... a)
   {
-    if (!impl || impl->slots_.empty())
+    constexpr bool move = I_move && is_forwarding_signature<T_arg...>();
+    if (!impl || impl->blocked())
       return T_return();
 
     signal_impl_holder exec(impl);
+    const emission_scope scope(impl.get());
     T_return r_ = T_return();
 
     // Use this scope to make sure that "slots" is destroyed before "exec" is destroyed.
@@ -321,7 +412,7 @@ public:
       auto it = slots.begin();
       for (; it != slots.end(); ++it)
       {
-        if (!it->empty() && !it->blocked())
+        if (!it->blocked() && !it->empty())
           break;
       }
 
@@ -332,12 +423,15 @@ public:
         return T_return();
       }
 
-      r_ = (reinterpret_cast<call_type>(it->rep_->call_))(it->rep_, a...);
+      const auto last = move ? slots.last_unblocked() : slots.end();
+      r_ = invoke_slot<T_return, T_arg...>(
+        impl.get(), *it, move && it == last, std::forward<type_trait_take_t<T_arg>>(a)...);
       for (++it; it != slots.end(); ++it)
       {
-        if (it->empty() || it->blocked())
+        if (it->blocked() || it->empty())
           continue;
-        r_ = (reinterpret_cast<call_type>(it->rep_->call_))(it->rep_, a...);
+        r_ = invoke_slot<T_return, T_arg...>(
+          impl.get(), *it, move && it == last, std::forward<type_trait_take_t<T_arg>>(a)...);
       }
     }
 
@@ -353,29 +447,29 @@ public:
 template <typename... T_arg>
 struct signal_emit<void, void, T_arg...>
 {
-private:
-  using slot_type = slot<void(T_arg...)>;
-  using call_type = typename slot_type::call_type;
-
-public:
-
   /** Executes a list of slots using an accumulator of type @e T_accumulator.
    * The arguments are passed directly on to the slots.
+   * If @e I_move is @p true, the last slot may move the arguments.
    * @param a Arguments to be passed on to the slots.
    */
+  template <bool I_move = false>
   static decltype(auto) emit(const std::shared_ptr<internal::signal_impl>& impl, type_trait_take_t<T_arg>... a)
   {
-    if (!impl || impl->slots_.empty())
+    constexpr bool move = I_move && is_forwarding_signature<T_arg...>();
+    if (!impl || impl->blocked())
       return;
     signal_impl_holder exec(impl);
+    const emission_scope scope(impl.get());
     const temp_slot_list slots(impl->slots_);
 
-    for (const auto& slot : slots)
+    const auto last = move ? slots.last_unblocked() : slots.end();
+    for (auto it = slots.begin(); it != slots.end(); ++it)
     {
-      if (slot.empty() || slot.blocked())
+      if (it->blocked() || it->empty())
         continue;
 
-      (reinterpret_cast<call_type>(slot.rep_->call_))(slot.rep_, a...);
+      invoke_slot<void, T_arg...>(
+        impl.get(), *it, move && it == last, std::forward<type_trait_take_t<T_arg>>(a)...);
     }
   }
 };
@@ -461,12 +555,52 @@ public:
    */
   decltype(auto) emit(type_trait_take_t<T_arg>... a) const
   {
+    if ((internal::instrumentation_flags.load(std::memory_order_relaxed) &
+          internal::instrument_record) &&
+        impl_ && impl_->recorded())
+      internal::emission_payload<internal::recordable_arguments<T_arg...>(), T_arg...>::record(
+        impl_.get(), a...);
+
     using emitter_type = internal::signal_emit<T_return, T_accumulator, T_arg...>;
-    return emitter_type::emit(impl_, a...);
+    return emitter_type::emit(impl_, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Triggers the emission of the signal, letting the last slot move the arguments.
+   * This is like emit(), but the arguments whose types are neither
+   * references nor small trivially copyable types (see sigc::type_trait)
+   * are taken as rvalue references. The slots are invoked with const
+   * references to them, except for the last slot that is invoked, which
+   * gets rvalue references. A slot that takes such an argument by value
+   * then moves it instead of copying it. Connect a slot last to make it
+   * the one that receives the arguments, for instance the slot that stores
+   * a message.
+   *
+   * If @e T_accumulator is not @p void, no slot moves the arguments.
+   *
+   * Arguments of types that can't be copied, such as std::unique_ptr, are
+   * always passed as rvalue references, by emit() too. Each slot then gets
+   * an rvalue reference to the same object. The first slot that takes it
+   * by value takes it over, and the following slots see a moved-from object.
+   * @param a Arguments to be passed on to the slots.
+   * @return The accumulated return values of the slot invocations.
+   */
+  decltype(auto) emit_move(type_trait_forward_t<T_arg>... a) const
+  {
+    if ((internal::instrumentation_flags.load(std::memory_order_relaxed) &
+          internal::instrument_record) &&
+        impl_ && impl_->recorded())
+      internal::emission_payload<internal::recordable_arguments<T_arg...>(), T_arg...>::record(
+        impl_.get(), a...);
+
+    using emitter_type = internal::signal_emit<T_return, T_accumulator, T_arg...>;
+    return emitter_type::template emit<true>(impl_, std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
   /** Triggers the emission of the signal (see emit()). */
-  decltype(auto) operator()(type_trait_take_t<T_arg>... a) const { return emit(a...); }
+  decltype(auto) operator()(type_trait_take_t<T_arg>... a) const
+  {
+    return emit(std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
 
   /** Creates a functor that calls emit() on this signal.
    * @code
@@ -16,6 +16,9 @@
  *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
  */
 #include <sigc++/signal_base.h>
+#include <sigc++/instrumentation.h>
+#include <sigc++/probes.h>
+#include <sigc++/stats.h>
 #include <memory> // std::unique_ptr
 
 namespace sigc
@@ -27,23 +30,35 @@ namespace internal
 // connected, and then sent from slot_rep::disconnect() to
 // signal_impl::notify_self_and_iter_of_invalidated_slot()
 // when the slot is disconnected. Bug 167714.
+// The signal_impl outlives the self_and_iter: it's deleted when the slot is
+// removed from the signal, at the latest by ~signal_impl().
 struct self_and_iter : public notifiable
 {
-  const std::weak_ptr<signal_impl> self_;
+  signal_impl* const self_;
   const signal_impl::iterator_type iter_;
 
-  self_and_iter(const std::weak_ptr<signal_impl>& self, const signal_impl::iterator_type& iter)
-  : self_(self), iter_(iter) {}
+  self_and_iter(signal_impl* self, const signal_impl::iterator_type& iter)
+  : self_(self), iter_(iter)
+  {
+    stats_add(stats_object::self_and_iter, sizeof(self_and_iter));
+  }
+
+  ~self_and_iter() { stats_remove(stats_object::self_and_iter, sizeof(self_and_iter)); }
 };
 
-signal_impl::signal_impl() : exec_count_(0), deferred_(false)
+signal_impl::signal_impl()
+: exec_count_(0), deferred_(false), recorded_(false), blocked_count_(0)
 {
+  stats_add(stats_object::signal_impl, sizeof(signal_impl));
 }
 
 signal_impl::~signal_impl()
 {
   // Disconnect all slots before *this is deleted.
   clear();
+  stats_remove(stats_object::signal_impl, sizeof(signal_impl));
+  if (recorded())
+    forget_recorded_signal(this);
 }
 
 // only MSVC needs this to guarantee that all new/delete are executed from the DLL module
@@ -87,6 +102,7 @@ signal_impl::clear()
   {
     deferred_ = saved_deferred;
     slots_.clear();
+    blocked_count_ = 0;
   }
 }
 
@@ -96,17 +112,6 @@ signal_impl::size() const noexcept
   return slots_.size();
 }
 
-bool
-signal_impl::blocked() const noexcept
-{
-  for (const auto& slot : const_cast<const std::list<slot_base>&>(slots_))
-  {
-    if (!slot.blocked())
-      return false;
-  }
-  return true;
-}
-
 void
 signal_impl::block(bool should_block) noexcept
 {
@@ -131,8 +136,22 @@ signal_impl::connect(slot_base&& slot_)
 void
 signal_impl::add_notification_to_iter(const signal_impl::iterator_type& iter)
 {
-  auto si = new self_and_iter(shared_from_this(), iter);
-  iter->set_parent(si, &signal_impl::notify_self_and_iter_of_invalidated_slot);
+  try
+  {
+    auto si = std::make_unique<self_and_iter>(this, iter);
+    // set_parent() may have to copy a shared slot_rep.
+    iter->set_parent(si.get(), &signal_impl::notify_self_and_iter_of_invalidated_slot);
+    si.release(); // Owned by the slot_rep now.
+  }
+  catch (...)
+  {
+    // The slot has no parent, so nothing else refers to it.
+    slots_.erase(iter);
+    throw;
+  }
+  if (iter->blocked())
+    ++blocked_count_;
+  SIGC_PROBE3(connect, this, iter->rep_, slots_.size());
 }
 
 signal_impl::iterator_type
@@ -160,14 +179,21 @@ signal_impl::sweep()
   signal_impl_holder exec(shared_from_this());
 
   deferred_ = false;
+  const auto size_before = slots_.size();
+  blocked_count_ = 0;
   auto i = slots_.begin();
   while (i != slots_.end())
   {
     if ((*i).empty())
       i = slots_.erase(i);
     else
+    {
+      if ((*i).blocked())
+        ++blocked_count_;
       ++i;
+    }
   }
+  SIGC_PROBE3(sweep, this, size_before, slots_.size());
 }
 
 // static
@@ -175,7 +201,7 @@ void
 signal_impl::notify_self_and_iter_of_invalidated_slot(notifiable* d)
 {
   std::unique_ptr<self_and_iter> si(static_cast<self_and_iter*>(d));
-  auto self = si->self_.lock();
+  auto self = si->self_->weak_from_this().lock();
   if (!self)
   {
     // The signal_impl object is being deleted. The use_count has reached 0.
@@ -190,6 +216,8 @@ signal_impl::notify_self_and_iter_of_invalidated_slot(notifiable* d)
     // In that case, the deletion of si->self_ is deferred to ~signal_impl_holder().
     // https://bugzilla.gnome.org/show_bug.cgi?id=564005#c24
     signal_impl_holder exec(self);
+    if (si->iter_->blocked())
+      --self->blocked_count_;
     self->slots_.erase(si->iter_);
   }
   else
@@ -202,6 +230,22 @@ signal_impl::notify_self_and_iter_of_invalidated_slot(notifiable* d)
   }
 }
 
+// static
+void
+signal_impl::notify_slot_blocked(const slot_rep* rep, bool should_block) noexcept
+{
+  // Only the slots in a signal's list of slots have this parent.
+  if (!rep->parent_ || rep->cleanup_ != &signal_impl::notify_self_and_iter_of_invalidated_slot)
+    return;
+
+  // No need to lock a weak pointer. The signal is alive while it holds the slot.
+  const auto self = static_cast<self_and_iter*>(rep->parent_)->self_;
+  if (should_block)
+    ++self->blocked_count_;
+  else
+    --self->blocked_count_;
+}
+
 } /* namespace internal */
 
 signal_base::signal_base() noexcept
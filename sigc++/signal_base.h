@@ -19,6 +19,7 @@
 #ifndef SIGC_SIGNAL_BASE_H
 #define SIGC_SIGNAL_BASE_H
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory> //For std::shared_ptr<>
@@ -95,11 +96,12 @@ struct SIGC_API signal_impl
   size_type size() const noexcept;
 
   /** Returns whether all slots in the list are blocked.
+   * This takes constant time.
    * @return @p true if all slots are blocked or the list is empty.
    *
    * @newin{2,4}
    */
-  bool blocked() const noexcept;
+  inline bool blocked() const noexcept { return blocked_count_ == slots_.size(); }
 
   /** Sets the blocking state of all slots in the list.
    * If @e should_block is @p true then the blocking state is set.
@@ -146,6 +148,27 @@ struct SIGC_API signal_impl
   /// Removes invalid slots from the list of slots.
   void sweep();
 
+  /** Returns whether an emission_recorder records the emissions of the signal.
+   * Emission checks this before the recorder's mutex is locked.
+   * @return @p true if the signal is recorded.
+   */
+  inline bool recorded() const noexcept { return recorded_.load(std::memory_order_relaxed); }
+
+  /** Sets whether an emission_recorder records the emissions of the signal.
+   * @param should_record The new recording state.
+   */
+  inline void set_recorded(bool should_record) noexcept
+  {
+    recorded_.store(should_record, std::memory_order_relaxed);
+  }
+
+  /** Tells the signal, if any, that holds a slot that the slot has been blocked or unblocked.
+   * slot_base::block() calls this, so that blocked() need not look at every slot.
+   * @param rep The slot_rep of the slot.
+   * @param should_block The new blocking state of the slot.
+   */
+  static void notify_slot_blocked(const slot_rep* rep, bool should_block) noexcept;
+
 private:
   /** Callback that is executed when some slot becomes invalid.
    * This callback is registered in every slot when inserted into
@@ -171,6 +194,17 @@ private:
 
   /// Indicates whether the execution of sweep() is being deferred.
   bool deferred_;
+
+  /** Whether an emission_recorder records the emissions.
+   * It's written by the recorder under its mutex, and read by emitting threads.
+   */
+  std::atomic<bool> recorded_;
+
+  /** The number of blocked slots in slots_.
+   * It may be too large or too small while slots that have been disconnected
+   * during signal emission wait for sweep(), which counts again.
+   */
+  unsigned int blocked_count_;
 };
 
 struct SIGC_API signal_impl_exec_holder
@@ -312,6 +346,7 @@ struct SIGC_API signal_base
   size_type size() const noexcept;
 
   /** Returns whether all slots in the list are blocked.
+   * This takes constant time.
    * @return @p true if all slots are blocked or the list is empty.
    *
    * @newin{2,4}
@@ -383,6 +418,9 @@ protected:
 
   /// The signal_impl object encapsulating the slot list.
   mutable std::shared_ptr<internal::signal_impl> impl_;
+
+  // The recorder identifies recorded signals by their signal_impl.
+  friend class emission_recorder;
 };
 
 } // namespace sigc
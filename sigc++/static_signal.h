@@ -0,0 +1,470 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_STATIC_SIGNAL_H
+#define SIGC_STATIC_SIGNAL_H
+
+#include <sigc++config.h>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+/** The common type of the return values of a static_signal's functors.
+ * It's @p void if there are no functors.
+ */
+template <typename... T_result>
+struct static_signal_result
+{
+  using type = std::common_type_t<T_result...>;
+};
+
+template <>
+struct static_signal_result<>
+{
+  using type = void;
+};
+
+/** Special iterator over the functors of a static_signal.
+ * This iterator is for use in accumulators. operator*() executes
+ * the functor. The return value is buffered, so that in an expression
+ * like @code a = (*i) * (*i); @endcode the functor is executed only once.
+ * It's the counterpart of slot_iterator_buf.
+ */
+template <typename T_emitter, typename T_result = typename T_emitter::result_type>
+struct static_slot_iterator_buf
+{
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  // These are needed just to make this a proper C++ iterator,
+  // that can be used with standard C++ algorithms.
+  using value_type = T_result;
+  using reference = T_result&;
+  using pointer = T_result*;
+
+  using emitter_type = T_emitter;
+
+  static_slot_iterator_buf(std::size_t i, const emitter_type* c) : i_(i), c_(c), invoked_(false)
+  {
+  }
+
+  decltype(auto) operator*() const
+  {
+    if (!invoked_)
+    {
+      c_->invoke(i_, r_);
+      invoked_ = true;
+    }
+    return r_;
+  }
+
+  static_slot_iterator_buf& operator++()
+  {
+    ++i_;
+    invoked_ = false;
+    return *this;
+  }
+
+  static_slot_iterator_buf operator++(int)
+  {
+    static_slot_iterator_buf tmp(*this);
+    ++i_;
+    invoked_ = false;
+    return tmp;
+  }
+
+  static_slot_iterator_buf& operator--()
+  {
+    --i_;
+    invoked_ = false;
+    return *this;
+  }
+
+  static_slot_iterator_buf operator--(int)
+  {
+    static_slot_iterator_buf tmp(*this);
+    --i_;
+    invoked_ = false;
+    return tmp;
+  }
+
+  bool operator==(const static_slot_iterator_buf& src) const { return i_ == src.i_; }
+
+  bool operator!=(const static_slot_iterator_buf& src) const { return i_ != src.i_; }
+
+private:
+  std::size_t i_;
+  const emitter_type* c_;
+  mutable T_result r_;
+  mutable bool invoked_;
+};
+
+/** Template specialization of static_slot_iterator_buf for functors that return void.
+ */
+template <typename T_emitter>
+struct static_slot_iterator_buf<T_emitter, void>
+{
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  using emitter_type = T_emitter;
+
+  static_slot_iterator_buf(std::size_t i, const emitter_type* c) : i_(i), c_(c), invoked_(false)
+  {
+  }
+
+  void operator*() const
+  {
+    if (!invoked_)
+    {
+      c_->invoke(i_);
+      invoked_ = true;
+    }
+  }
+
+  static_slot_iterator_buf& operator++()
+  {
+    ++i_;
+    invoked_ = false;
+    return *this;
+  }
+
+  static_slot_iterator_buf operator++(int)
+  {
+    static_slot_iterator_buf tmp(*this);
+    ++i_;
+    invoked_ = false;
+    return tmp;
+  }
+
+  static_slot_iterator_buf& operator--()
+  {
+    --i_;
+    invoked_ = false;
+    return *this;
+  }
+
+  static_slot_iterator_buf operator--(int)
+  {
+    static_slot_iterator_buf tmp(*this);
+    --i_;
+    invoked_ = false;
+    return tmp;
+  }
+
+  bool operator==(const static_slot_iterator_buf& src) const { return i_ == src.i_; }
+
+  bool operator!=(const static_slot_iterator_buf& src) const { return i_ != src.i_; }
+
+private:
+  std::size_t i_;
+  const emitter_type* c_;
+  mutable bool invoked_;
+};
+
+/** Abstracts the emission of a static_signal.
+ * This template implements the emit() function of
+ * static_signal_with_accumulator. It buffers references to the arguments,
+ * and calls the functor that an iterator points to, when the accumulator
+ * dereferences the iterator.
+ */
+template <typename T_accumulator, typename T_functors, typename... T_arg>
+struct static_signal_emit;
+
+template <typename T_accumulator, typename... T_functor, typename... T_arg>
+struct static_signal_emit<T_accumulator, std::tuple<T_functor...>, T_arg...>
+{
+  using self_type = static_signal_emit<T_accumulator, std::tuple<T_functor...>, T_arg...>;
+  using result_type = typename static_signal_result<decltype(
+    std::declval<T_functor&>()(std::declval<T_arg&>()...))...>::type;
+
+  static_signal_emit(std::tuple<T_functor...>& functors, T_arg&... a)
+  : functors_(functors), a_(a...)
+  {
+  }
+
+  /** Executes the functors using an accumulator of type @e T_accumulator.
+   * No functor moves the arguments, even if @e I_move is @p true.
+   * @param functors The functors to execute.
+   * @param a Arguments to be passed on to the functors.
+   * @return The accumulated return values of the functors as processed by the accumulator.
+   */
+  template <bool I_move = false>
+  static decltype(auto) emit(std::tuple<T_functor...>& functors, T_arg&... a)
+  {
+    using iterator_type = static_slot_iterator_buf<self_type, result_type>;
+
+    T_accumulator accumulator;
+    const self_type self(functors, a...);
+    return accumulator(iterator_type(0, &self), iterator_type(sizeof...(T_functor), &self));
+  }
+
+  /** Executes the functor with index @p i and stores its return value in @p r.
+   */
+  template <typename T_result>
+  void invoke(std::size_t i, T_result& r) const
+  {
+    invoke(i, r, std::index_sequence_for<T_functor...>(), std::index_sequence_for<T_arg...>());
+  }
+
+  /** Executes the functor with index @p i.
+   */
+  void invoke(std::size_t i) const
+  {
+    invoke(i, std::index_sequence_for<T_functor...>(), std::index_sequence_for<T_arg...>());
+  }
+
+private:
+  std::tuple<T_functor...>& functors_;
+  std::tuple<T_arg&...> a_;
+
+  // A chain of comparisons with the constant indexes, which the compiler can
+  // turn into a jump table, or drop entirely if the accumulator's loop is unrolled.
+  template <typename T_result, std::size_t... I_functor, std::size_t... I_arg>
+  void invoke(std::size_t i, T_result& r, std::index_sequence<I_functor...>,
+    std::index_sequence<I_arg...>) const
+  {
+    (void)((i == I_functor &&
+             ((void)(r = std::get<I_functor>(functors_)(std::get<I_arg>(a_)...)), true)) ||
+           ...);
+  }
+
+  template <std::size_t... I_functor, std::size_t... I_arg>
+  void invoke(std::size_t i, std::index_sequence<I_functor...>, std::index_sequence<I_arg...>) const
+  {
+    (void)((i == I_functor && ((void)std::get<I_functor>(functors_)(std::get<I_arg>(a_)...), true)) ||
+           ...);
+  }
+};
+
+/** Abstracts the emission of a static_signal.
+ * This template specialization implements emit() for the case that no
+ * accumulator is used. The functors are called one after the other,
+ * and the return value of the last one is returned.
+ */
+template <typename... T_functor, typename... T_arg>
+struct static_signal_emit<void, std::tuple<T_functor...>, T_arg...>
+{
+  /** Executes the functors.
+   * If @e I_move is @p true, the last functor may move the arguments.
+   * @param functors The functors to execute.
+   * @param a Arguments to be passed on to the functors.
+   * @return The return value of the last functor.
+   */
+  template <bool I_move = false>
+  static decltype(auto) emit(std::tuple<T_functor...>& functors, T_arg&... a)
+  {
+    return emit<I_move>(functors, std::make_index_sequence<sizeof...(T_functor) - 1>(), a...);
+  }
+
+private:
+  template <bool I_move, std::size_t... I>
+  static decltype(auto) emit(
+    std::tuple<T_functor...>& functors, std::index_sequence<I...>, T_arg&... a)
+  {
+    ((void)std::get<I>(functors)(a...), ...);
+    return std::get<sizeof...(I)>(functors)(
+      static_cast<std::conditional_t<I_move, T_arg&&, T_arg&>>(a)...);
+  }
+};
+
+template <typename... T_arg>
+struct static_signal_emit<void, std::tuple<>, T_arg...>
+{
+  template <bool I_move = false>
+  static void emit(std::tuple<>&, T_arg&...)
+  {
+  }
+};
+
+} /* namespace internal */
+
+/** Signal with a fixed list of functors, which are known at compile time.
+ *
+ * The functors, of types @e T_functor, are stored by value in a std::tuple.
+ * emit() calls them in order, directly. Unlike sigc::signal, a static_signal
+ * doesn't convert its functors to slots, so emit() needs no indirect calls,
+ * no list traversal and no memory allocation, and the compiler can inline
+ * the functors. Any functor can be used, including the adaptors and
+ * sigc::mem_fun<&T::method>(obj).
+ *
+ * Functors can't be connected or disconnected later, and no functor is
+ * disconnected automatically when a sigc::trackable that it refers to is
+ * destroyed. The objects that the functors refer to must outlive the signal.
+ * Emissions of a static_signal are not seen by the instrumentation of
+ * sigc::signal, such as probes, tracing and profiling.
+ *
+ * The following template arguments are used:
+ * - @e T_accumulator The accumulator type used for emission, as in
+ * sigc::signal_with_accumulator. The default @p void means that no
+ * accumulator is used, and that emit() returns the value of the last functor.
+ * - @e T_functor The types of the functors.
+ *
+ * You should use the more convenient sigc::static_signal template.
+ *
+ * @ingroup signal
+ */
+template <typename T_accumulator, typename... T_functor>
+class static_signal_with_accumulator
+{
+public:
+  static_signal_with_accumulator() = default;
+
+  /** Constructs a static signal with the functors it calls.
+   * @param functors The functors, in the order in which emit() calls them.
+   */
+  template <typename... T_init,
+    typename = std::enable_if_t<sizeof...(T_init) == sizeof...(T_functor) &&
+                                sizeof...(T_init) != 0 &&
+                                std::is_constructible<std::tuple<T_functor...>, T_init&&...>::value>>
+  explicit static_signal_with_accumulator(T_init&&... functors)
+  : functors_(std::forward<T_init>(functors)...)
+  {
+  }
+
+  /** Returns the number of functors.
+   * @return The number of functors.
+   */
+  static constexpr std::size_t size() noexcept { return sizeof...(T_functor); }
+
+  /** Returns whether there are no functors.
+   * @return @p true if there are no functors.
+   */
+  static constexpr bool empty() noexcept { return sizeof...(T_functor) == 0; }
+
+  /** Triggers the emission of the signal.
+   * During signal emission all functors are called in order.
+   * Each functor gets the arguments as lvalues.
+   *
+   * If @e T_accumulator is not @p void, an accumulator of this type
+   * is used to process the return values of the functor invocations.
+   * Otherwise, the return value of the last functor is returned.
+   * @param a Arguments to be passed on to the functors.
+   * @return The accumulated return values of the functor invocations.
+   */
+  template <typename... T_arg>
+  decltype(auto) emit(T_arg&&... a) const
+  {
+    using emitter_type =
+      internal::static_signal_emit<T_accumulator, std::tuple<T_functor...>, T_arg...>;
+    return emitter_type::emit(functors_, a...);
+  }
+
+  /** Triggers the emission of the signal, letting the last functor move the arguments.
+   * This is like emit(), but the arguments that are passed as rvalues are
+   * passed on as rvalues to the last functor.
+   * If @e T_accumulator is not @p void, no functor moves the arguments.
+   * @param a Arguments to be passed on to the functors.
+   * @return The accumulated return values of the functor invocations.
+   */
+  template <typename... T_arg>
+  decltype(auto) emit_move(T_arg&&... a) const
+  {
+    using emitter_type =
+      internal::static_signal_emit<T_accumulator, std::tuple<T_functor...>, T_arg...>;
+    return emitter_type::template emit<true>(functors_, a...);
+  }
+
+  /** Triggers the emission of the signal (see emit()). */
+  template <typename... T_arg>
+  decltype(auto) operator()(T_arg&&... a) const
+  {
+    return emit(std::forward<T_arg>(a)...);
+  }
+
+  /** Returns one of the functors.
+   * @tparam I_index The index of the functor.
+   * @return A reference to the functor.
+   */
+  template <std::size_t I_index>
+  decltype(auto) get() noexcept
+  {
+    return std::get<I_index>(functors_);
+  }
+
+  /** Returns one of the functors.
+   * @tparam I_index The index of the functor.
+   * @return A const reference to the functor.
+   */
+  template <std::size_t I_index>
+  decltype(auto) get() const noexcept
+  {
+    return std::get<I_index>(functors_);
+  }
+
+private:
+  // Like the functors in slots, the functors are called from the const emit().
+  mutable std::tuple<T_functor...> functors_;
+};
+
+/** Signal with a fixed list of functors, which are known at compile time.
+ * It's a static_signal_with_accumulator without an accumulator.
+ * The functor types can be deduced from the constructor's arguments:
+ *
+ * @code
+ * void on_changed(int);
+ * sigc::static_signal changed(sigc::ptr_fun<&on_changed>(),
+ *   sigc::mem_fun<&Window::on_changed>(window), [](int i) { std::cout << i; });
+ * changed.emit(19);
+ * @endcode
+ *
+ * To specify an accumulator type the nested class static_signal::accumulated
+ * can be used:
+ *
+ * @code
+ * auto f1 = [](int i) { return i; };
+ * auto f2 = [](int i) { return i * 2; };
+ * sigc::static_signal<decltype(f1), decltype(f2)>::accumulated<sum_accumulator> sig(f1, f2);
+ * @endcode
+ *
+ * @ingroup signal
+ */
+template <typename... T_functor>
+class static_signal : public static_signal_with_accumulator<void, T_functor...>
+{
+public:
+  using static_signal_with_accumulator<void, T_functor...>::static_signal_with_accumulator;
+
+  /** Like sigc::static_signal but the additional template parameter @e T_accumulator
+   * defines the accumulator type that should be used.
+   * See sigc::signal::accumulated for a description of accumulators.
+   */
+  template <typename T_accumulator>
+  class accumulated : public static_signal_with_accumulator<T_accumulator, T_functor...>
+  {
+  public:
+    using static_signal_with_accumulator<T_accumulator, T_functor...>::static_signal_with_accumulator;
+  };
+};
+
+template <typename... T_functor>
+static_signal(T_functor...) -> static_signal<T_functor...>;
+
+} /* namespace sigc */
+
+#endif /* SIGC_STATIC_SIGNAL_H */
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <sigc++/stats.h>
+#include <atomic>
+
+namespace
+{
+constexpr std::size_t object_kinds = 6;
+constexpr std::size_t size_classes = sigc::stats_snapshot::slot_rep_size_classes;
+
+// Upper limits of the slot_rep size classes. 0 means unbounded.
+constexpr std::size_t slot_rep_limits[size_classes] = { 64, 96, 128, 256, 1024, 0 };
+
+#ifdef SIGCXX_ENABLE_STATS
+
+// The counters are zero-initialized before any dynamic initialization,
+// so objects with static storage duration can be counted safely.
+// Each counter has a cache line of its own. Different kinds of objects
+// are created and destroyed by different threads, and they should not
+// contend for one cache line.
+struct alignas(64) atomic_counter
+{
+  std::atomic<std::size_t> count;
+  std::atomic<std::size_t> bytes;
+
+  void add(std::size_t b, std::size_t n) noexcept
+  {
+    count.fetch_add(n, std::memory_order_relaxed);
+    bytes.fetch_add(b * n, std::memory_order_relaxed);
+  }
+
+  void remove(std::size_t b, std::size_t n) noexcept
+  {
+    count.fetch_sub(n, std::memory_order_relaxed);
+    bytes.fetch_sub(b * n, std::memory_order_relaxed);
+  }
+
+  sigc::stats_counter load() const noexcept
+  {
+    return { count.load(std::memory_order_relaxed), bytes.load(std::memory_order_relaxed) };
+  }
+};
+
+atomic_counter counters[object_kinds];
+atomic_counter slot_rep_counters[size_classes];
+
+std::size_t
+slot_rep_size_class(std::size_t bytes) noexcept
+{
+  std::size_t i = 0;
+  while (i < size_classes - 1 && bytes > slot_rep_limits[i])
+    ++i;
+  return i;
+}
+
+#endif /* SIGCXX_ENABLE_STATS */
+
+} // anonymous namespace
+
+namespace sigc
+{
+
+constexpr std::size_t stats_snapshot::slot_rep_size_classes;
+
+// static
+std::size_t
+stats_snapshot::slot_rep_size_class_limit(std::size_t size_class) noexcept
+{
+  return size_class < size_classes ? slot_rep_limits[size_class] : 0;
+}
+
+#ifdef SIGCXX_ENABLE_STATS
+
+stats_snapshot
+stats() noexcept
+{
+  using internal::stats_object;
+
+  stats_snapshot s;
+  s.signal_impls = counters[static_cast<std::size_t>(stats_object::signal_impl)].load();
+  s.slot_reps = counters[static_cast<std::size_t>(stats_object::slot_rep)].load();
+  for (std::size_t i = 0; i < size_classes; ++i)
+    s.slot_reps_by_size[i] = slot_rep_counters[i].load();
+  s.trackable_callback_lists =
+    counters[static_cast<std::size_t>(stats_object::trackable_callback_list)].load();
+  s.trackable_callbacks =
+    counters[static_cast<std::size_t>(stats_object::trackable_callback)].load();
+  s.self_and_iters = counters[static_cast<std::size_t>(stats_object::self_and_iter)].load();
+  s.connections = counters[static_cast<std::size_t>(stats_object::connection)].load();
+  return s;
+}
+
+namespace internal
+{
+
+void
+stats_add(stats_object what, std::size_t bytes, std::size_t n) noexcept
+{
+  counters[static_cast<std::size_t>(what)].add(bytes, n);
+  if (what == stats_object::slot_rep)
+    slot_rep_counters[slot_rep_size_class(bytes)].add(bytes, n);
+}
+
+void
+stats_remove(stats_object what, std::size_t bytes, std::size_t n) noexcept
+{
+  counters[static_cast<std::size_t>(what)].remove(bytes, n);
+  if (what == stats_object::slot_rep)
+    slot_rep_counters[slot_rep_size_class(bytes)].remove(bytes, n);
+}
+
+} /* namespace internal */
+
+#else /* !SIGCXX_ENABLE_STATS */
+
+stats_snapshot
+stats() noexcept
+{
+  return stats_snapshot{};
+}
+
+#endif /* !SIGCXX_ENABLE_STATS */
+
+} /* namespace sigc */
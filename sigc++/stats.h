@@ -0,0 +1,171 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_STATS_H
+#define SIGC_STATS_H
+
+#include <cstddef>
+#include <sigc++config.h>
+
+namespace sigc
+{
+
+/** Number of live objects of one kind, and the memory they occupy.
+ * The byte count is the sum of the sizeof() values of the objects.
+ * Allocator overhead is not included.
+ *
+ * @ingroup stats
+ */
+struct SIGC_API stats_counter
+{
+  /// Number of live objects.
+  std::size_t count;
+
+  /// Bytes occupied by the live objects.
+  std::size_t bytes;
+};
+
+/** A snapshot of libsigc++'s live internal objects.
+ * Returned by sigc::stats().
+ *
+ * slot_rep objects are additionally classified by the size of their
+ * concrete type, including the stored functor. slot_reps_by_size[i]
+ * counts the slot_rep objects whose size is at most
+ * slot_rep_size_class_limit(i), but larger than the previous limit.
+ * The last size class is unbounded.
+ *
+ * @ingroup stats
+ */
+struct SIGC_API stats_snapshot
+{
+  /// Number of size classes in slot_reps_by_size.
+  static constexpr std::size_t slot_rep_size_classes = 6;
+
+  /** Returns the upper size limit, in bytes, of a slot_rep size class.
+   * @param size_class An index into slot_reps_by_size.
+   * @return The largest size counted in @a size_class, or 0 for the
+   *         last, unbounded, size class.
+   */
+  static std::size_t slot_rep_size_class_limit(std::size_t size_class) noexcept;
+
+  /// sigc::internal::signal_impl objects, i.e. signals that have been connected to.
+  stats_counter signal_impls;
+
+  /// sigc::internal::slot_rep objects, including the functors they store.
+  stats_counter slot_reps;
+
+  /// slot_reps, classified by size.
+  stats_counter slot_reps_by_size[slot_rep_size_classes];
+
+  /// Callback lists allocated by sigc::trackable objects.
+  stats_counter trackable_callback_lists;
+
+  /// Nodes in the callback lists of sigc::trackable objects.
+  stats_counter trackable_callbacks;
+
+  /// Notification objects of slots connected to signals.
+  stats_counter self_and_iters;
+
+  /** sigc::connection objects.
+   * Unlike the other counters, this one counts handles that are usually
+   * not allocated on the heap, but are members of other objects or local
+   * variables. Their bytes are not heap memory.
+   */
+  stats_counter connections;
+};
+
+/** @defgroup stats Statistics
+ * sigc::stats() reports how many of libsigc++'s internal objects are alive,
+ * and how much memory they occupy. They can be read periodically in
+ * production code, e.g. to detect a growing number of slots that are
+ * disconnected but not yet removed from their signals.
+ *
+ * Maintaining the counters costs a few atomic operations whenever a slot,
+ * a connection or a trackable's callback is created or destroyed. They are
+ * maintained only if libsigc++ is built with stats enabled, which is the
+ * default (CMake option SIGCXX_ENABLE_STATS, configure option
+ * --enable-stats). Otherwise SIGCXX_ENABLE_STATS is not defined in
+ * sigc++config.h, the counting compiles to nothing, and stats() returns
+ * only zeros.
+ *
+ * @code
+ * const auto s = sigc::stats();
+ * std::cout << s.slot_reps.count << " slots, " << s.slot_reps.bytes << " bytes" << std::endl;
+ * @endcode
+ *
+ * The counters are global to the process. They are updated atomically,
+ * so stats() can be called from any thread, but a snapshot is not taken
+ * atomically as a whole.
+ */
+
+/** Takes a snapshot of the live object counters.
+ * @return The current values of all counters.
+ *
+ * @ingroup stats
+ */
+SIGC_API stats_snapshot stats() noexcept;
+
+namespace internal
+{
+
+/// Kinds of objects counted by sigc::stats().
+enum class stats_object
+{
+  signal_impl,
+  slot_rep,
+  trackable_callback_list,
+  trackable_callback,
+  self_and_iter,
+  connection
+};
+
+#ifdef SIGCXX_ENABLE_STATS
+
+/** Registers the creation of objects.
+ * @param what The kind of object.
+ * @param bytes The size of one object.
+ * @param n The number of objects.
+ */
+SIGC_API void stats_add(stats_object what, std::size_t bytes, std::size_t n = 1) noexcept;
+
+/** Registers the destruction of objects.
+ * @param what The kind of object.
+ * @param bytes The size of one object.
+ * @param n The number of objects.
+ */
+SIGC_API void stats_remove(stats_object what, std::size_t bytes, std::size_t n = 1) noexcept;
+
+#else /* !SIGCXX_ENABLE_STATS */
+
+inline void
+stats_add(stats_object, std::size_t, std::size_t = 1) noexcept
+{
+}
+
+inline void
+stats_remove(stats_object, std::size_t, std::size_t = 1) noexcept
+{
+}
+
+#endif /* !SIGCXX_ENABLE_STATS */
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif /* SIGC_STATS_H */
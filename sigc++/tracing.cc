@@ -0,0 +1,341 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <sigc++/tracing.h>
+#include <sigc++/instrumentation.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+enum class event_kind : unsigned char
+{
+  emission_begin,
+  emission_end,
+  slot_begin,
+  slot_end
+};
+
+struct trace_event
+{
+  std::uint64_t ns;
+  const void* sig;
+  const void* rep;
+  const std::type_info* type; // Only for slot_begin.
+  event_kind kind;
+};
+
+// A ring buffer with a single producer, the thread that owns it,
+// and a single consumer, write_trace_events() under buffers_mutex.
+struct thread_buffer
+{
+  thread_buffer(std::size_t capacity, unsigned number, unsigned gen)
+  : events(new trace_event[capacity]),
+    mask(capacity - 1),
+    thread_number(number),
+    generation(gen)
+  {
+  }
+
+  // A begin event is only pushed if there is also room for its end event,
+  // and for the end events of the begin events that are still open.
+  // Otherwise a trace viewer would see an event that never ends.
+  bool push_begin(const trace_event& event) noexcept
+  {
+    if (!push(event, open_begins + 1))
+      return false;
+    ++open_begins;
+    return true;
+  }
+
+  // Uses the room reserved by push_begin(), unless the begin event
+  // was pushed to a buffer that has since been replaced.
+  void push_end(const trace_event& event) noexcept
+  {
+    if (open_begins)
+      --open_begins;
+    push(event, 0);
+  }
+
+  bool push(const trace_event& event, std::uint64_t reserved) noexcept
+  {
+    const auto h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) + reserved > mask)
+    {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    events[h & mask] = event;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  template <typename T_consumer>
+  void drain(T_consumer consume)
+  {
+    const auto h = head.load(std::memory_order_acquire);
+    auto t = tail.load(std::memory_order_relaxed);
+    for (; t != h; ++t)
+      consume(events[t & mask]);
+    tail.store(t, std::memory_order_release);
+  }
+
+  std::unique_ptr<trace_event[]> events;
+  const std::uint64_t mask;
+  const unsigned thread_number;
+  const unsigned generation;
+  std::atomic<std::uint64_t> head{ 0 };
+  std::atomic<std::uint64_t> tail{ 0 };
+  std::atomic<std::uint64_t> dropped{ 0 };
+
+  // Number of pushed begin events whose end events have not been pushed.
+  // Only used by the owning thread.
+  std::uint64_t open_begins = 0;
+};
+
+std::atomic<std::size_t> buffer_capacity(0);
+std::atomic<unsigned> buffer_generation(0);
+std::atomic<unsigned> thread_count(0);
+
+std::mutex buffers_mutex;
+std::vector<std::shared_ptr<thread_buffer>> buffers;
+
+thread_local std::shared_ptr<thread_buffer> current_buffer;
+thread_local unsigned current_thread_number = 0;
+
+std::uint64_t
+trace_now() noexcept
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+// Returns the buffer of the calling thread, or nullptr if it can't be allocated.
+thread_buffer*
+local_buffer() noexcept
+{
+  const auto generation = buffer_generation.load(std::memory_order_acquire);
+  if (current_buffer && current_buffer->generation == generation)
+    return current_buffer.get();
+
+  try
+  {
+    if (!current_thread_number)
+      current_thread_number = ++thread_count;
+
+    auto buffer = std::make_shared<thread_buffer>(
+      buffer_capacity.load(std::memory_order_relaxed), current_thread_number, generation);
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    buffers.push_back(buffer);
+    current_buffer = std::move(buffer);
+  }
+  catch (...)
+  {
+    return nullptr;
+  }
+  return current_buffer.get();
+}
+
+bool
+record_begin(event_kind kind, const void* sig, const void* rep, const std::type_info* type) noexcept
+{
+  const auto buffer = local_buffer();
+  return buffer && buffer->push_begin({ trace_now(), sig, rep, type, kind });
+}
+
+void
+record_end(event_kind kind, const void* sig, const void* rep) noexcept
+{
+  if (const auto buffer = local_buffer())
+    buffer->push_end({ trace_now(), sig, rep, nullptr, kind });
+}
+
+void
+write_json_string(std::ostream& out, const std::string& str)
+{
+  static const char hex_digits[] = "0123456789abcdef";
+  out << '"';
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      out << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      out << "\\u00" << hex_digits[c >> 4] << hex_digits[c & 0xf];
+    else
+      out << c;
+  }
+  out << '"';
+}
+
+// Writes a timestamp in microseconds, as expected by the trace viewers.
+void
+write_timestamp(std::ostream& out, std::uint64_t ns)
+{
+  const auto fraction = static_cast<unsigned>(ns % 1000);
+  out << ns / 1000 << '.' << char('0' + fraction / 100) << char('0' + fraction / 10 % 10)
+      << char('0' + fraction % 10);
+}
+
+std::string
+address_string(const void* address)
+{
+  std::ostringstream str;
+  str << address;
+  return str.str();
+}
+
+} // anonymous namespace
+
+namespace sigc
+{
+
+void
+start_tracing(std::size_t events_per_thread)
+{
+  std::size_t capacity = 2;
+  while (capacity < events_per_thread)
+    capacity <<= 1;
+
+  if (buffer_capacity.exchange(capacity) != capacity)
+    buffer_generation.fetch_add(1, std::memory_order_release);
+  internal::instrumentation_flags.fetch_or(internal::instrument_trace);
+}
+
+void
+stop_tracing()
+{
+  internal::instrumentation_flags.fetch_and(~internal::instrument_trace);
+}
+
+std::size_t
+write_trace_events(std::ostream& out)
+{
+  std::lock_guard<std::mutex> lock(buffers_mutex);
+
+  std::size_t count = 0;
+  std::uint64_t dropped = 0;
+  std::unordered_map<const std::type_info*, std::string> slot_names;
+  std::vector<unsigned> thread_numbers;
+
+  // Buffers of exited threads, and buffers that have been replaced,
+  // receive no more events. They are released after they have been written.
+  std::vector<bool> released(buffers.size());
+  for (std::size_t i = 0; i < buffers.size(); ++i)
+    released[i] = buffers[i].use_count() == 1;
+
+  out << "{\"traceEvents\":[";
+  for (const auto& buffer : buffers)
+  {
+    const auto tid = buffer->thread_number;
+    buffer->drain([&out, &count, &slot_names, tid](const trace_event& event) {
+      out << (count++ ? ",\n" : "\n") << "{\"pid\":1,\"tid\":" << tid << ",\"ts\":";
+      write_timestamp(out, event.ns);
+      out << ",";
+      switch (event.kind)
+      {
+        case event_kind::emission_begin:
+          out << "\"ph\":\"B\",\"cat\":\"signal\",\"name\":";
+          write_json_string(out, "emit " + address_string(event.sig));
+          out << ",\"args\":{\"signal\":\"" << event.sig << "\"}}";
+          break;
+        case event_kind::emission_end:
+          out << "\"ph\":\"E\",\"cat\":\"signal\"}";
+          break;
+        case event_kind::slot_begin:
+        {
+          out << "\"ph\":\"B\",\"cat\":\"slot\",\"name\":";
+          auto& name = slot_names[event.type];
+          if (name.empty())
+            name = internal::slot_functor_name(*event.type);
+          write_json_string(out, name);
+          out << ",\"args\":{\"slot\":\"" << event.rep << "\"";
+          if (event.sig)
+            out << ",\"signal\":\"" << event.sig << "\"";
+          out << "}}";
+          break;
+        }
+        case event_kind::slot_end:
+          out << "\"ph\":\"E\",\"cat\":\"slot\"}";
+          break;
+      }
+    });
+    dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+
+    bool known = false;
+    for (const auto n : thread_numbers)
+      known = known || n == tid;
+    if (!known)
+      thread_numbers.push_back(tid);
+  }
+
+  for (const auto tid : thread_numbers)
+  {
+    out << (count++ ? ",\n" : "\n") << "{\"pid\":1,\"tid\":" << tid
+        << ",\"ph\":\"M\",\"name\":\"thread_name\",\"args\":{\"name\":\"thread " << tid << "\"}}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":" << dropped << "}}\n";
+
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < buffers.size(); ++i)
+  {
+    if (!released[i])
+      buffers[kept++] = std::move(buffers[i]);
+  }
+  buffers.resize(kept);
+
+  return count - thread_numbers.size();
+}
+
+namespace internal
+{
+
+bool
+trace_emission_begin(const signal_impl* sig) noexcept
+{
+  return record_begin(event_kind::emission_begin, sig, nullptr, nullptr);
+}
+
+void
+trace_emission_end(const signal_impl* sig) noexcept
+{
+  record_end(event_kind::emission_end, sig, nullptr);
+}
+
+bool
+trace_slot_begin(const signal_impl* sig, const slot_rep* rep, const std::type_info& type) noexcept
+{
+  return record_begin(event_kind::slot_begin, sig, rep, &type);
+}
+
+void
+trace_slot_end(const signal_impl* sig, const slot_rep* rep) noexcept
+{
+  record_end(event_kind::slot_end, sig, rep);
+}
+
+} /* namespace internal */
+
+} /* namespace sigc */
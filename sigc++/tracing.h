@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIGC_TRACING_H
+#define SIGC_TRACING_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <typeinfo>
+#include <sigc++config.h>
+
+namespace sigc
+{
+
+/** @defgroup tracing Tracing
+ * When tracing is switched on, each signal emission and each slot
+ * invocation is recorded as a pair of begin and end events, with the
+ * thread and a timestamp. The recorded events can be written in the
+ * JSON format of Chrome's trace viewer, which can be loaded into
+ * chrome://tracing or https://ui.perfetto.dev. Nested emissions, where a
+ * slot emits another signal, are shown as nested slices.
+ *
+ * @code
+ * sigc::start_tracing();
+ * run_one_frame();
+ * sigc::stop_tracing();
+ * std::ofstream file("frame.json");
+ * sigc::write_trace_events(file);
+ * @endcode
+ *
+ * Emissions are labelled with the address of the signal. Slot invocations
+ * are labelled with the demangled type of the functor that the slot contains,
+ * and are recorded both when they are invoked by a signal, and when
+ * slot::operator()() is called directly.
+ *
+ * Each thread records its events into its own fixed-size ring buffer,
+ * without locking. When a thread's buffer is full, further events of that
+ * thread are dropped until write_trace_events() empties the buffer.
+ * If a begin event is dropped, the corresponding end event is dropped too.
+ * A begin event is only recorded if there is room for its end event, so
+ * every recorded begin event has an end event, even in a full buffer.
+ */
+
+/** Switches tracing on.
+ * @param events_per_thread The capacity of the buffer of each thread.
+ *        It's rounded up to a power of 2. Each event takes about 40 bytes.
+ *        If the capacity differs from the previous call, each thread gets a
+ *        new buffer when it records its next event. Events in the old
+ *        buffers are kept until they are written.
+ *
+ * @ingroup tracing
+ */
+SIGC_API void start_tracing(std::size_t events_per_thread = 65536);
+
+/** Switches tracing off.
+ * The recorded events are kept until they are written with write_trace_events().
+ *
+ * @ingroup tracing
+ */
+SIGC_API void stop_tracing();
+
+/** Writes the recorded events as Chrome trace-event JSON, and discards them.
+ * This may be called while tracing is on, e.g. periodically from a
+ * separate thread. The number of events that have been dropped since the
+ * previous call is written into the @c otherData object of the JSON output.
+ * @param out The stream to write the JSON object to.
+ * @return The number of written events.
+ *
+ * @ingroup tracing
+ */
+SIGC_API std::size_t write_trace_events(std::ostream& out);
+
+namespace internal
+{
+
+struct slot_rep;
+struct signal_impl;
+
+/** Records the begin of a signal emission.
+ * @param sig The emitting signal.
+ * @return Whether the event has been recorded.
+ *         If it has, trace_emission_end() must be called when the emission ends.
+ */
+SIGC_API bool trace_emission_begin(const signal_impl* sig) noexcept;
+
+/** Records the end of a signal emission.
+ * @param sig The emitting signal.
+ */
+SIGC_API void trace_emission_end(const signal_impl* sig) noexcept;
+
+/** Records the begin of a slot invocation.
+ * @param sig The signal that invokes the slot, or nullptr.
+ * @param rep The slot_rep of the invoked slot.
+ * @param type The dynamic type of @a rep, from slot_rep_type().
+ * @return Whether the event has been recorded.
+ *         If it has, trace_slot_end() must be called when the invocation ends.
+ */
+SIGC_API bool trace_slot_begin(
+  const signal_impl* sig, const slot_rep* rep, const std::type_info& type) noexcept;
+
+/** Records the end of a slot invocation.
+ * @param sig The signal that invoked the slot, or nullptr.
+ * @param rep The slot_rep of the invoked slot. It may have been deleted.
+ */
+SIGC_API void trace_slot_end(const signal_impl* sig, const slot_rep* rep) noexcept;
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif /* SIGC_TRACING_H */
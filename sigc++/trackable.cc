@@ -18,6 +18,7 @@
  */
 
 #include <sigc++/trackable.h>
+#include <sigc++/stats.h>
 
 namespace sigc
 {
@@ -84,15 +85,24 @@ trackable::remove_destroy_notify_callback(notifiable* data) const
 void
 trackable::notify_callbacks()
 {
-  delete callback_list_; // This invokes all of the callbacks.
-  callback_list_ = nullptr;
+  if (callback_list_)
+  {
+    delete callback_list_; // This invokes all of the callbacks.
+    callback_list_ = nullptr;
+    internal::stats_remove(
+      internal::stats_object::trackable_callback_list, sizeof(internal::trackable_callback_list));
+  }
 }
 
 internal::trackable_callback_list*
 trackable::callback_list() const
 {
   if (!callback_list_)
+  {
     callback_list_ = new internal::trackable_callback_list;
+    internal::stats_add(
+      internal::stats_object::trackable_callback_list, sizeof(internal::trackable_callback_list));
+  }
 
   return callback_list_;
 }
@@ -100,6 +110,13 @@ trackable::callback_list() const
 namespace internal
 {
 
+namespace
+{
+// The size of a node in trackable_callback_list::callbacks_, as reported by sigc::stats().
+// A std::list node holds two pointers besides the element.
+constexpr std::size_t callback_node_size = sizeof(trackable_callback) + 2 * sizeof(void*);
+} // anonymous namespace
+
 trackable_callback_list::~trackable_callback_list()
 {
   clearing_ = true;
@@ -109,6 +126,8 @@ trackable_callback_list::~trackable_callback_list()
     if (callback.func_)
       callback.func_(callback.data_);
   }
+
+  stats_remove(stats_object::trackable_callback, callback_node_size, callbacks_.size());
 }
 
 void
@@ -119,7 +138,10 @@ trackable_callback_list::add_callback(notifiable* data, func_destroy_notify func
   // I'd consider this a serious application bug, since the app is likely to segfault.
   // But then, how should we handle it? Throw an exception? Martin.
   if (!clearing_)
+  {
     callbacks_.emplace_back(trackable_callback(data, func));
+    stats_add(stats_object::trackable_callback, callback_node_size);
+  }
 }
 
 void
@@ -133,6 +155,7 @@ trackable_callback_list::clear()
       callback.func_(callback.data_);
   }
 
+  stats_remove(stats_object::trackable_callback, callback_node_size, callbacks_.size());
   callbacks_.clear();
 
   clearing_ = false;
@@ -152,7 +175,10 @@ trackable_callback_list::remove_callback(notifiable* data)
       if (clearing_)
         callback.func_ = nullptr;
       else
+      {
         callbacks_.erase(i);
+        stats_remove(stats_object::trackable_callback, callback_node_size);
+      }
       return;
     }
   }
@@ -18,9 +18,7 @@
 #ifndef SIGC_TUPLE_UTILS_TUPLE_CDR_H
 #define SIGC_TUPLE_UTILS_TUPLE_CDR_H
 
-#include <tuple>
-#include <type_traits>
-#include <utility>
+#include <sigc++/tuple-utils/tuple_start.h>
 
 namespace sigc
 {
@@ -41,19 +39,6 @@ struct tuple_type_cdr<std::tuple<H, T...>>
   using type = std::tuple<T...>;
 };
 
-namespace detail
-{
-
-template <typename T, std::size_t... I>
-constexpr decltype(auto)
-tuple_cdr_impl(T&& t, std::index_sequence<0, I...>)
-{
-  using cdr = typename tuple_type_cdr<std::decay_t<T>>::type;
-  return cdr(std::get<I>(std::forward<T>(t))...);
-}
-
-} // detail namespace
-
 /**
  * Get the a tuple without the first item.
  * This is analogous to std::tuple_cat().
@@ -66,8 +51,7 @@ tuple_cdr(T&& t)
   constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
 
   static_assert(size != 0, "tuple size must be non-zero");
-  using seq = std::make_index_sequence<size>;
-  return detail::tuple_cdr_impl(std::forward<T>(t), seq{});
+  return detail::tuple_slice<1>(std::forward<T>(t), std::make_index_sequence<size - 1>());
 }
 
 } // namespace internal
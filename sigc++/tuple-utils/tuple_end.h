@@ -18,7 +18,7 @@
 #ifndef SIGC_TUPLE_UTILS_TUPLE_END_H
 #define SIGC_TUPLE_UTILS_TUPLE_END_H
 
-#include <sigc++/tuple-utils/tuple_cdr.h>
+#include <sigc++/tuple-utils/tuple_start.h>
 
 namespace sigc
 {
@@ -26,36 +26,6 @@ namespace sigc
 namespace internal
 {
 
-namespace detail
-{
-
-template <typename T, std::size_t remove_from_start>
-struct tuple_end_impl
-{
-  constexpr static decltype(auto) // typename tuple_type_end<T, size - remove_from_start>::type
-    tuple_end(T&& t)
-  {
-    static_assert(remove_from_start > 0, "remove_from_start must be more than zero.");
-
-    using cdr = typename tuple_type_cdr<std::decay_t<T>>::type;
-    return tuple_end_impl<cdr, remove_from_start - 1>::tuple_end(tuple_cdr(std::forward<T>(t)));
-  }
-};
-
-template <typename T>
-struct tuple_end_impl<T, 1>
-{
-  constexpr static decltype(auto) tuple_end(T&& t) { return tuple_cdr(std::forward<T>(t)); }
-};
-
-template <typename T>
-struct tuple_end_impl<T, 0>
-{
-  constexpr static decltype(auto) tuple_end(T&& t) { return std::forward<T>(t); }
-};
-
-} // detail namespace
-
 /**
  * Get the tuple with the last @a len items of the original.
  */
@@ -66,8 +36,8 @@ constexpr decltype(auto) // typename tuple_type_end<T, len>::type
   // We use std::decay_t<> because tuple_size is not defined for references.
   constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
   static_assert(len <= size, "The tuple size must be less than or equal to the length.");
-  constexpr auto size_start = size - len;
-  return detail::tuple_end_impl<T, size_start>::tuple_end(std::forward<T>(t));
+
+  return detail::tuple_slice<size - len>(std::forward<T>(t), std::make_index_sequence<len>());
 }
 
 } // namespace internal
@@ -18,7 +18,10 @@
 #ifndef SIGC_TUPLE_UTILS_TUPLE_FOR_EACH_H
 #define SIGC_TUPLE_UTILS_TUPLE_FOR_EACH_H
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace sigc
 {
@@ -29,55 +32,18 @@ namespace internal
 namespace detail
 {
 
-template <template <typename> class T_visitor, std::size_t size_from_index, typename... T_extras>
-struct tuple_for_each_impl
-{
-  template <typename T>
-  constexpr static void tuple_for_each(T&& t, T_extras&&... extras)
-  {
-    // We use std::decay_t<> because tuple_size is not defined for references.
-    constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
-    static_assert(size > 1, "size must be more than 0.");
-
-    constexpr auto index = size - size_from_index;
-    static_assert(index >= 0, "unexpected index.");
-
-    using element_type = typename std::tuple_element<index, std::decay_t<T>>::type;
-    T_visitor<element_type>::visit(std::get<index>(t), std::forward<T_extras>(extras)...);
-
-    tuple_for_each_impl<T_visitor, size_from_index - 1, T_extras...>::tuple_for_each(
-      std::forward<T>(t), std::forward<T_extras>(extras)...);
-  }
-};
-
-template <template <typename> class T_visitor, typename... T_extras>
-struct tuple_for_each_impl<T_visitor, 1, T_extras...>
-{
-  template <typename T>
-  constexpr static void tuple_for_each(T&& t, T_extras&&... extras)
-  {
-    // We use std::decay_t<> because tuple_size is not defined for references.
-    constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
-    static_assert(size > 0, "size must be more than 0.");
-
-    constexpr auto index = size - 1;
-    static_assert(index >= 0, "unexpected index.");
-
-    using element_type = typename std::tuple_element<index, std::decay_t<T>>::type;
-    T_visitor<element_type>::visit(
-      std::get<index>(std::forward<T>(t)), std::forward<T_extras>(extras)...);
-  }
-};
-
-template <template <typename> class T_visitor, typename... T_extras>
-struct tuple_for_each_impl<T_visitor, 0, T_extras...>
+template <template <typename> class T_visitor, typename T, std::size_t... I,
+  typename... T_extras>
+constexpr void
+tuple_for_each_impl(T& t, std::index_sequence<I...>, T_extras&... extras)
 {
-  template <typename T>
-  constexpr static void tuple_for_each(T&& /* t */, T_extras&&... /* extras */)
-  {
-    // Do nothing because the tuple has no elements.
-  }
-};
+  // The elements of a braced initializer list are evaluated in order.
+  const int in_order[] = { 0,
+    (T_visitor<typename std::tuple_element<I, std::decay_t<T>>::type>::visit(
+       std::get<I>(t), extras...),
+      0)... };
+  static_cast<void>(in_order);
+}
 
 } // detail namespace
 
@@ -99,13 +65,7 @@ tuple_for_each(T&& t, T_extras&&... extras)
   // We use std::decay_t<> because tuple_size is not defined for references.
   constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
 
-  if (size == 0)
-  {
-    return;
-  }
-
-  detail::tuple_for_each_impl<T_visitor, size, T_extras...>::tuple_for_each(
-    std::forward<T>(t), std::forward<T_extras>(extras)...);
+  detail::tuple_for_each_impl<T_visitor>(t, std::make_index_sequence<size>(), extras...);
 }
 
 } // namespace internal
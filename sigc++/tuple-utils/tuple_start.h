@@ -18,7 +18,9 @@
 #ifndef SIGC_TUPLE_UTILS_TUPLE_START_H
 #define SIGC_TUPLE_UTILS_TUPLE_START_H
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace sigc
@@ -39,6 +41,18 @@ struct tuple_type_start_impl<T, std::index_sequence<I...>>
   using type = std::tuple<typename std::tuple_element<I, T>::type...>;
 };
 
+/**
+ * Get the tuple of the items at @a offset + I... of the original.
+ * The items of an rvalue tuple are moved, the items of an lvalue tuple are copied.
+ */
+template <std::size_t offset, typename T, std::size_t... I>
+constexpr decltype(auto)
+tuple_slice(T&& t, std::index_sequence<I...>)
+{
+  using slice = std::tuple<typename std::tuple_element<offset + I, std::decay_t<T>>::type...>;
+  return slice(std::get<offset + I>(std::forward<T>(t))...);
+}
+
 } // detail namespace
 
 /**
@@ -49,41 +63,18 @@ struct tuple_type_start : detail::tuple_type_start_impl<T, std::make_index_seque
 {
 };
 
-namespace detail
-{
-
-template <typename T, typename Seq>
-struct tuple_start_impl;
-
-template <typename T, std::size_t... I>
-struct tuple_start_impl<T, std::index_sequence<I...>>
-{
-  static constexpr decltype(auto) tuple_start(T&& t)
-  {
-    constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
-    constexpr auto len = sizeof...(I);
-    static_assert(len <= size, "The tuple size must be less than or equal to the length.");
-
-    using start = typename tuple_type_start<std::decay_t<T>, len>::type;
-    return start(std::get<I>(std::forward<T>(t))...);
-  }
-};
-
-} // detail namespace
-
 /**
- * Get the tuple with the last @a len items of the original.
+ * Get the tuple with the first @a len items of the original.
  */
 template <std::size_t len, typename T>
-constexpr decltype(auto) // typename tuple_type_end<T, len>::type
+constexpr decltype(auto) // typename tuple_type_start<T, len>::type
   tuple_start(T&& t)
 {
   // We use std::decay_t<> because tuple_size is not defined for references.
   constexpr auto size = std::tuple_size<std::decay_t<T>>::value;
   static_assert(len <= size, "The tuple size must be less than or equal to the length.");
 
-  return detail::tuple_start_impl<T, std::make_index_sequence<len>>::tuple_start(
-    std::forward<T>(t));
+  return detail::tuple_slice<0>(std::forward<T>(t), std::make_index_sequence<len>());
 }
 
 } // namespace internal
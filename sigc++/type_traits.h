@@ -20,15 +20,71 @@
 #define SIGC_TYPE_TRAIT_H
 
 #include <sigc++config.h>
+#include <type_traits>
 
 namespace sigc
 {
 
+namespace internal
+{
+
+/** Whether a value of type @e T_type is passed by value rather than by reference.
+ * This is true for trivially copyable types no larger than two pointers,
+ * which most ABIs pass in registers.
+ */
+template <typename T_type, bool I_trivially_copyable = std::is_trivially_copyable<T_type>::value>
+struct is_passed_by_value : public std::false_type
+{
+};
+
 template <typename T_type>
-struct type_trait
+struct is_passed_by_value<T_type, true>
+: public std::integral_constant<bool, sizeof(T_type) <= 2 * sizeof(void*)>
+{
+};
+
+template <typename T_type, bool I_by_value = is_passed_by_value<T_type>::value,
+  bool I_copyable = std::is_copy_constructible<T_type>::value>
+struct value_type_trait
 {
   using pass = T_type&;
   using take = const T_type&;
+  using forward = T_type&&;
+};
+
+template <typename T_type, bool I_copyable>
+struct value_type_trait<T_type, true, I_copyable>
+{
+  using pass = T_type;
+  using take = T_type;
+  using forward = T_type;
+};
+
+template <typename T_type>
+struct value_type_trait<T_type, false, false>
+{
+  using pass = T_type&&;
+  using take = T_type&&;
+  using forward = T_type&&;
+};
+
+} /* namespace internal */
+
+/** How arguments of type @e T_type are passed through signals, slots and adaptors.
+ * take is the type of the parameters of emit(), slot::operator()() and the
+ * functions that slots call. pass is the type with which adaptors pass
+ * arguments on to the functors that they wrap. forward is the type of the
+ * parameters of signal::emit_move(), whose arguments the last slot may move.
+ *
+ * References are passed as they are. Small trivially copyable types, such as
+ * int, double and pointers, are passed by value, so that they can travel in
+ * registers. Types that can't be copied are passed by rvalue reference.
+ * Other types are passed by const reference, or by rvalue reference to
+ * emit_move().
+ */
+template <typename T_type>
+struct type_trait : public internal::value_type_trait<T_type>
+{
 };
 
 template <typename T_type, int N>
@@ -36,6 +92,7 @@ struct type_trait<T_type[N]>
 {
   using pass = T_type*&;
   using take = const T_type*&;
+  using forward = const T_type*&;
 };
 
 template <typename T_type>
@@ -43,6 +100,7 @@ struct type_trait<T_type&>
 {
   using pass = T_type&;
   using take = T_type&;
+  using forward = T_type&;
 };
 
 template <typename T_type>
@@ -50,6 +108,15 @@ struct type_trait<const T_type&>
 {
   using pass = const T_type&;
   using take = const T_type&;
+  using forward = const T_type&;
+};
+
+template <typename T_type>
+struct type_trait<T_type&&>
+{
+  using pass = T_type&&;
+  using take = T_type&&;
+  using forward = T_type&&;
 };
 
 template <>
@@ -57,6 +124,7 @@ struct type_trait<void>
 {
   using pass = void;
   using take = void;
+  using forward = void;
 };
 
 template <typename T>
@@ -65,6 +133,54 @@ using type_trait_pass_t = typename type_trait<T>::pass;
 template <typename T>
 using type_trait_take_t = typename type_trait<T>::take;
 
+template <typename T>
+using type_trait_forward_t = typename type_trait<T>::forward;
+
+namespace internal
+{
+
+/** Whether some of the arguments of a signal or slot can be moved.
+ * That's the case if the take and the forward types of an argument differ.
+ * The slots of such a signature are called with a flag that tells them
+ * whether they may move their arguments.
+ */
+template <typename... T_arg>
+constexpr bool
+is_forwarding_signature()
+{
+  const bool forwarding[] = { false,
+    !std::is_same<type_trait_take_t<T_arg>, type_trait_forward_t<T_arg>>::value... };
+  for (const bool f : forwarding)
+    if (f)
+      return true;
+  return false;
+}
+
+/** Converts an argument from its take type to its forward type.
+ * The argument must not be used afterwards, if it has been moved.
+ */
+template <typename T_arg,
+  bool I_moved = !std::is_same<type_trait_take_t<T_arg>, type_trait_forward_t<T_arg>>::value>
+struct forward_arg
+{
+  static type_trait_forward_t<T_arg> convert(type_trait_take_t<T_arg> a)
+  {
+    return static_cast<type_trait_forward_t<T_arg>>(a);
+  }
+};
+
+template <typename T_arg>
+struct forward_arg<T_arg, true>
+{
+  // The take type is a const reference to a non-const object.
+  static type_trait_forward_t<T_arg> convert(type_trait_take_t<T_arg> a)
+  {
+    return const_cast<type_trait_forward_t<T_arg>>(a);
+  }
+};
+
+} /* namespace internal */
+
 } /* namespace sigc */
 
 #endif /* SIGC_TYPE_TRAIT_H */
@@ -2,6 +2,9 @@
 /* Define to omit deprecated API from the library. */
 #cmakedefine SIGCXX_DISABLE_DEPRECATED
 
+/* Define to count live objects for sigc::stats(). */
+#cmakedefine SIGCXX_ENABLE_STATS
+
 /* Major version number of sigc++. */
 #cmakedefine SIGCXX_MAJOR_VERSION @SIGCXX_MAJOR_VERSION@
 
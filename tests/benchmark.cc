@@ -1,113 +1,516 @@
-/* Copyright 2003 - 2016, The libsigc++ Development Team
+/* Copyright 2003 - 2026, The libsigc++ Development Team
  *  Assigned to public domain.  Use as you wish without restriction.
  */
 
-#include <iostream>
-#include <sigc++/signal.h>
-#include <sigc++/functors/mem_fun.h>
-#include <boost/timer/timer.hpp>
+#include "benchmark_harness.h"
+#include "reference_dispatchers.h"
+#include <sigc++/sigc++.h>
+#include <sigc++/tuple-utils/tuple_cdr.h>
+#include <sigc++/tuple-utils/tuple_end.h>
+#include <sigc++/tuple-utils/tuple_for_each.h>
+#include <sigc++/tuple-utils/tuple_start.h>
+#include <sigc++/tuple-utils/tuple_transform_each.h>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
 
-const int COUNT = 10000000;
+namespace
+{
 
 struct foo : public sigc::trackable
 {
   int bar(int a);
-  int c;
+  void baz(int a) { c += a; }
+  int c = 0;
 };
 
-int foo::bar(int a)
+int
+foo::bar(int a)
 {
   int b = c;
   c = a;
   return b;
 }
 
-void test_slot_call()
+int
+add3(int a, int b, int c)
 {
-  foo foobar1;
+  return a + b + c;
+}
 
-  // slot benchmark ...
+int
+twice(int a)
+{
+  return a * 2;
+}
 
-  sigc::slot<int(int)> slot = sigc::mem_fun(foobar1, &foo::bar);
+int
+one()
+{
+  return 1;
+}
 
-  std::cout << "elapsed time for calling a slot " << COUNT << " times:" << std::endl;
-  boost::timer::auto_cpu_timer timer;
+int
+narrow(long a)
+{
+  return static_cast<int>(a);
+}
 
-  for (int i=0; i < COUNT; ++i)
-    slot(i);
+double
+half(int a)
+{
+  return a * 0.5;
 }
 
-void test_signal_emit()
+template <std::size_t I_size>
+struct payload
 {
-  sigc::signal<int(int)> emitter;
+  std::array<unsigned char, I_size> bytes;
+};
+
+struct sum_accumulator
+{
+  using result_type = int;
+
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
 
-  std::cout << "elapsed time for " << COUNT << " emissions (0 slots):" << std::endl;
-  boost::timer::auto_cpu_timer timer;
+void
+bench_slot_call(BenchmarkHarness& h)
+{
+  foo foobar;
+  sigc::slot<int(int)> slot = sigc::mem_fun(foobar, &foo::bar);
+  int i = 0;
+  h.run("slot/call/mem_fun", [&]() { do_not_optimize(slot(++i)); });
 
-  for (int i=0; i < COUNT; ++i)
-    emitter(i);
+  h.run("slot/construct+destroy/mem_fun", [&]() {
+    sigc::slot<int(int)> s = sigc::mem_fun(foobar, &foo::bar);
+    do_not_optimize(s);
+  });
 }
 
-void test_connected_signal_emit()
+void
+bench_emit_slot_counts(BenchmarkHarness& h)
 {
-  foo foobar1;
-  sigc::signal<int(int)> emitter;
-  emitter.connect(mem_fun(foobar1, &foo::bar));
+  for (const int count : { 0, 1, 5, 100, 10000 })
+  {
+    const auto suffix = "/slots:" + std::to_string(count);
+    std::vector<foo> foos(count);
+
+    if (h.selected("emit/int(int)" + suffix))
+    {
+      sigc::signal<int(int)> emitter;
+      for (auto& f : foos)
+        emitter.connect(sigc::mem_fun(f, &foo::bar));
+      int i = 0;
+      h.run("emit/int(int)" + suffix, [&]() { do_not_optimize(emitter(++i)); });
+    }
 
-  std::cout << "elapsed time for " << COUNT << " emissions (1 slot):" << std::endl;
-  boost::timer::auto_cpu_timer timer;
+    if (h.selected("emit/void(int)" + suffix))
+    {
+      sigc::signal<void(int)> emitter;
+      for (auto& f : foos)
+        emitter.connect(sigc::mem_fun(f, &foo::baz));
+      int i = 0;
+      h.run("emit/void(int)" + suffix, [&]() { emitter(++i); });
+    }
 
-  for (int i=0; i < COUNT; ++i)
-    emitter(i);
+    if (count > 0 && count <= 100 && h.selected("emit/int(int)/accumulated" + suffix))
+    {
+      sigc::signal<int(int)>::accumulated<sum_accumulator> emitter;
+      for (auto& f : foos)
+        emitter.connect(sigc::mem_fun(f, &foo::bar));
+      int i = 0;
+      h.run("emit/int(int)/accumulated" + suffix, [&]() { do_not_optimize(emitter(++i)); });
+    }
+  }
 }
 
-void test_connected_multiple_signal_emit()
+void
+bench_static_signal(BenchmarkHarness& h)
 {
-  foo foobar1, foobar2, foobar3, foobar4, foobar5;
+  // The same topology as emit/int(int)/slots:5, known at compile time.
+  std::vector<foo> foos(5);
+  const sigc::static_signal emitter(sigc::mem_fun<&foo::bar>(foos[0]),
+    sigc::mem_fun<&foo::bar>(foos[1]), sigc::mem_fun<&foo::bar>(foos[2]),
+    sigc::mem_fun<&foo::bar>(foos[3]), sigc::mem_fun<&foo::bar>(foos[4]));
+  int i = 0;
+  h.run("emit/static/int(int)/slots:5", [&]() { do_not_optimize(emitter(++i)); });
+
+  using emitter_type = std::remove_const_t<decltype(emitter)>;
+  const emitter_type::accumulated<sum_accumulator> accumulated(emitter.get<0>(),
+    emitter.get<1>(), emitter.get<2>(), emitter.get<3>(), emitter.get<4>());
+  h.run(
+    "emit/static/int(int)/accumulated/slots:5", [&]() { do_not_optimize(accumulated(++i)); });
+}
+
+template <typename T_arg>
+void
+bench_emit_argument(BenchmarkHarness& h, const std::string& name, const T_arg& arg)
+{
+  const auto full_name = "emit/argument/" + name + "/slots:5";
+  if (!h.selected(full_name))
+    return;
+
+  std::size_t sum = 0;
+  sigc::signal<void(const T_arg&)> emitter;
+  for (int i = 0; i < 5; ++i)
+    emitter.connect([&sum](const T_arg& a) { sum += sizeof(a); });
+  h.run(full_name, [&]() { emitter(arg); });
+  do_not_optimize(sum);
+}
+
+void
+bench_emit_arguments(BenchmarkHarness& h)
+{
+  bench_emit_argument(h, "int", 1);
+  bench_emit_argument(h, "bytes:8", payload<8>());
+  bench_emit_argument(h, "bytes:64", payload<64>());
+  bench_emit_argument(h, "bytes:1024", payload<1024>());
+  bench_emit_argument(h, "std::string", std::string(100, 'x'));
+}
+
+template <typename T_functor>
+void
+bench_adaptor(BenchmarkHarness& h, const std::string& name, const T_functor& functor)
+{
+  const auto full_name = "emit/adaptor/" + name;
+  if (!h.selected(full_name))
+    return;
 
   sigc::signal<int(int)> emitter;
-  emitter.connect(mem_fun(foobar2, &foo::bar));
-  emitter.connect(mem_fun(foobar3, &foo::bar));
-  emitter.connect(mem_fun(foobar4, &foo::bar));
-  emitter.connect(mem_fun(foobar5, &foo::bar));
+  emitter.connect(functor);
+  int i = 0;
+  h.run(full_name, [&]() { do_not_optimize(emitter(++i)); });
+}
 
-  std::cout << "elapsed time for " << COUNT << " emissions (5 slots):" << std::endl;
-  boost::timer::auto_cpu_timer timer;;
+void
+bench_adaptors(BenchmarkHarness& h)
+{
+  foo foobar;
+  bench_adaptor(h, "ptr_fun", sigc::ptr_fun(&twice));
+  bench_adaptor(h, "mem_fun", sigc::mem_fun(foobar, &foo::bar));
+  bench_adaptor(h, "lambda", [](int a) { return a * 2; });
+  bench_adaptor(h, "bind", sigc::bind(sigc::ptr_fun(&add3), 1, 2));
+  bench_adaptor(h, "hide", sigc::hide(sigc::ptr_fun(&one)));
+  bench_adaptor(h, "retype", sigc::retype(sigc::ptr_fun(&narrow)));
+  bench_adaptor(h, "retype_return", sigc::retype_return<int>(sigc::ptr_fun(&half)));
+  bench_adaptor(h, "compose", sigc::compose(sigc::ptr_fun(&twice), sigc::ptr_fun(&twice)));
+  bench_adaptor(h, "track_obj", sigc::track_obj([](int a) { return a; }, foobar));
+  bench_adaptor(h, "bind+hide+retype_return",
+    sigc::retype_return<int>(sigc::hide(sigc::bind(sigc::ptr_fun(&add3), 1, 2, 3))));
+}
+
+struct return_minus_one
+{
+  int operator()() const { return -1; }
+};
 
-  for (int i=0; i < COUNT; ++i)
-    emitter(i);
+// The heap bytes of a slot_rep for T_functor, as sigc::stats() counts them.
+template <typename T_functor>
+double
+slot_rep_bytes()
+{
+  return sizeof(sigc::internal::typed_slot_rep<T_functor>) +
+         sizeof(typename sigc::adaptor_trait<T_functor>::adaptor_type);
 }
 
-void test_connect_disconnect()
+template <typename T_functor>
+void
+bench_call(BenchmarkHarness& h, const std::string& name, T_functor functor)
 {
-  foo foobar1;
+  int i = 0;
+  h.run(name + "/direct", [&]() { do_not_optimize(functor(++i)); },
+    { { "functor_bytes", sizeof(T_functor) } });
+
+  sigc::slot<int(int)> slot = functor;
+  h.run(name + "/slot", [&]() { do_not_optimize(slot(++i)); },
+    { { "rep_bytes", slot_rep_bytes<T_functor>() } });
+}
+
+// Compares an adaptor stack with a lambda that does the same, both called
+// directly and through a slot.
+template <typename T_adaptor, typename T_lambda>
+void
+bench_adaptor_pair(BenchmarkHarness& h, const std::string& name, const T_adaptor& adaptor,
+  const T_lambda& lambda)
+{
+  bench_call(h, "call/" + name + "/adaptor", adaptor);
+  bench_call(h, "call/" + name + "/lambda", lambda);
+}
+
+void
+bench_adaptor_matrix(BenchmarkHarness& h)
+{
+  foo foobar;
+  bench_adaptor_pair(h, "ptr_fun", sigc::ptr_fun(&twice), [](int a) { return twice(a); });
+  bench_adaptor_pair(h, "bind", sigc::bind(sigc::ptr_fun(&add3), 1, 2),
+    [](int a) { return add3(a, 1, 2); });
+  bench_adaptor_pair(h, "hide", sigc::hide(sigc::ptr_fun(&one)), [](int) { return one(); });
+  bench_adaptor_pair(h, "retype", sigc::retype(sigc::ptr_fun(&narrow)),
+    [](int a) { return narrow(a); });
+  bench_adaptor_pair(h, "retype_return", sigc::retype_return<int>(sigc::ptr_fun(&half)),
+    [](int a) { return static_cast<int>(half(a)); });
+  bench_adaptor_pair(h, "compose", sigc::compose(sigc::ptr_fun(&twice), sigc::ptr_fun(&twice)),
+    [](int a) { return twice(twice(a)); });
+  bench_adaptor_pair(h, "track_obj", sigc::track_obj([](int a) { return twice(a); }, foobar),
+    [](int a) { return twice(a); });
+  bench_adaptor_pair(h, "exception_catch",
+    sigc::exception_catch(sigc::ptr_fun(&twice), return_minus_one()), [](int a) {
+      try
+      {
+        return twice(a);
+      }
+      catch (...)
+      {
+        return -1;
+      }
+    });
+  bench_adaptor_pair(h, "bind+hide+retype_return",
+    sigc::retype_return<int>(sigc::hide(sigc::bind(sigc::ptr_fun(&add3), 1, 2, 3))),
+    [](int) { return add3(1, 2, 3); });
+  bench_adaptor_pair(h, "bind+compose+retype+track_obj",
+    sigc::track_obj(
+      sigc::compose(sigc::bind(sigc::ptr_fun(&add3), 1, 2), sigc::retype(sigc::ptr_fun(&narrow))),
+      foobar),
+    [](int a) { return add3(narrow(a), 1, 2); });
+}
+
+void
+bench_blocked(BenchmarkHarness& h)
+{
+  for (const int percent : { 0, 50, 90, 100 })
+  {
+    const auto name = "emit/blocked:" + std::to_string(percent) + "%/slots:100";
+    if (!h.selected(name))
+      continue;
+
+    std::vector<foo> foos(100);
+    sigc::signal<void(int)> emitter;
+    std::vector<sigc::connection> connections;
+    for (auto& f : foos)
+      connections.push_back(emitter.connect(sigc::mem_fun(f, &foo::baz)));
+    for (std::size_t i = 0; i < connections.size(); ++i)
+    {
+      // Spread the blocked slots evenly.
+      if (i * percent / 100 != (i + 1) * percent / 100)
+        connections[i].block();
+    }
+
+    int i = 0;
+    h.run(name, [&]() { emitter(++i); });
+  }
+}
+
+void
+bench_nested(BenchmarkHarness& h)
+{
+  for (const int depth : { 1, 4 })
+  {
+    const auto name = "emit/nested/depth:" + std::to_string(depth);
+    if (!h.selected(name))
+      continue;
+
+    // signals[0] emits signals[1], which emits signals[2] and so on.
+    std::vector<std::unique_ptr<sigc::signal<void(int)>>> signals;
+    for (int d = 0; d <= depth; ++d)
+      signals.emplace_back(new sigc::signal<void(int)>());
+    for (int d = 0; d < depth; ++d)
+    {
+      auto next = signals[d + 1].get();
+      signals[d]->connect([next](int a) { next->emit(a + 1); });
+    }
+    foo foobar;
+    signals.back()->connect(sigc::mem_fun(foobar, &foo::baz));
+
+    int i = 0;
+    h.run(name, [&]() { signals[0]->emit(++i); });
+  }
+}
+
+void
+bench_connect_disconnect(BenchmarkHarness& h)
+{
+  foo foobar;
   sigc::signal<int(int)> emitter;
-  sigc::connection conn;
+  h.run("connect+disconnect/mem_fun", [&]() {
+    auto conn = emitter.connect(sigc::mem_fun(foobar, &foo::bar));
+    conn.disconnect();
+  });
+
+  h.run("connect+disconnect/lambda", [&]() {
+    auto conn = emitter.connect([](int a) { return a; });
+    conn.disconnect();
+  });
+
+  // Connecting to and disconnecting from a signal with many slots.
+  std::vector<foo> foos(1000);
+  for (auto& f : foos)
+    emitter.connect(sigc::mem_fun(f, &foo::bar));
+  h.run("connect+disconnect/mem_fun/slots:1000", [&]() {
+    auto conn = emitter.connect(sigc::mem_fun(foobar, &foo::bar));
+    conn.disconnect();
+  });
+}
+
+int dispatch_sum = 0;
 
-  std::cout << "elapsed time for " << COUNT << " connections/disconnections:" << std::endl;
-  boost::timer::auto_cpu_timer timer;
+void
+dispatch_target(int a)
+{
+  dispatch_sum += a;
+}
+
+// sigc::signal compared with the dispatchers in reference_dispatchers.h.
+// All of them call the same free function.
+void
+bench_reference_dispatch(BenchmarkHarness& h)
+{
+  const std::string signal_prefix = "dispatch/sigc::signal/";
+  const std::string function_prefix = "dispatch/std::function/";
+  const std::string pointer_prefix = "dispatch/function_pointer/";
+
+  for (const int count : { 1, 5, 100 })
+  {
+    const auto name = "emit/slots:" + std::to_string(count);
+    int i = 0;
 
-  for (int i=0; i < COUNT; ++i)
+    sigc::signal<void(int)> signal;
+    function_dispatcher<void(int)> functions;
+    function_pointer_dispatcher<void(int), 128> pointers;
+    for (int c = 0; c < count; ++c)
     {
-      conn = emitter.connect(mem_fun(foobar1, &foo::bar));
-      conn.disconnect();
+      signal.connect(sigc::ptr_fun(&dispatch_target));
+      functions.connect(&dispatch_target);
+      pointers.connect(&dispatch_target);
     }
+
+    h.run(signal_prefix + name, [&]() { signal.emit(++i); });
+    h.run(function_prefix + name, [&]() { functions.emit(++i); });
+    h.run(pointer_prefix + name, [&]() { pointers.emit(++i); });
+    h.compare(signal_prefix + name, function_prefix + name);
+    h.compare(signal_prefix + name, pointer_prefix + name);
+  }
+
+  // Connecting to and disconnecting from a dispatcher with 10 slots.
+  const std::string name = "connect+disconnect/slots:10";
+  sigc::signal<void(int)> signal;
+  function_dispatcher<void(int)> functions;
+  function_pointer_dispatcher<void(int), 16> pointers;
+  for (int c = 0; c < 10; ++c)
+  {
+    signal.connect(sigc::ptr_fun(&dispatch_target));
+    functions.connect(&dispatch_target);
+    pointers.connect(&dispatch_target);
+  }
+
+  h.run(signal_prefix + name, [&]() {
+    auto connection = signal.connect(sigc::ptr_fun(&dispatch_target));
+    connection.disconnect();
+  });
+  h.run(function_prefix + name,
+    [&]() { functions.disconnect(functions.connect(&dispatch_target)); });
+  h.run(pointer_prefix + name, [&]() {
+    pointers.connect(&dispatch_target);
+    pointers.disconnect(&dispatch_target);
+  });
+  h.compare(signal_prefix + name, function_prefix + name);
+  h.compare(signal_prefix + name, pointer_prefix + name);
+  do_not_optimize(dispatch_sum);
 }
 
-int main()
+void
+bench_churn(BenchmarkHarness& h)
 {
-  // slot benchmark ...
-  test_slot_call();
+  for (const int count : { 10, 1000 })
+  {
+    const auto name = "emit/churn/slots:" + std::to_string(count);
+    if (!h.selected(name))
+      continue;
+
+    std::vector<foo> foos(count);
+    sigc::signal<void(int)> emitter;
+    for (auto& f : foos)
+      emitter.connect(sigc::mem_fun(f, &foo::baz));
 
-  // emission benchmark (zero slots) ...
-  test_signal_emit();
+    // Each emission calls a slot that disconnects itself, so that the emission
+    // ends with a sweep() of the slot list. Then a new such slot is connected.
+    sigc::connection churned;
+    const auto connect_churned = [&]() {
+      churned = emitter.connect([&churned](int) { churned.disconnect(); });
+    };
+    connect_churned();
 
-  // emission benchmark (one slot) ...
-  test_connected_signal_emit();
+    int i = 0;
+    h.run(name, [&]() {
+      emitter(++i);
+      connect_churned();
+    });
+  }
+}
+
+template <typename T_element>
+struct tuple_doubler
+{
+  static T_element transform(T_element& element) { return element * 2; }
+};
+
+template <typename T_element>
+struct tuple_summer
+{
+  static void visit(const T_element& element, long& sum) { sum += element; }
+};
+
+// The tuple utilities with the tuple of a bind() of several arguments.
+void
+bench_tuple_utils(BenchmarkHarness& h)
+{
+  auto t = std::make_tuple(1, 2L, 3, 4L, 5, 6L, 7, 8L);
+  h.run("tuple/start", [&]() { do_not_optimize(sigc::internal::tuple_start<6>(t)); });
+  h.run("tuple/end", [&]() { do_not_optimize(sigc::internal::tuple_end<6>(t)); });
+  h.run("tuple/cdr", [&]() { do_not_optimize(sigc::internal::tuple_cdr(t)); });
+  h.run("tuple/transform_each",
+    [&]() { do_not_optimize(sigc::internal::tuple_transform_each<tuple_doubler>(t)); });
+  h.run("tuple/for_each", [&]() {
+    long sum = 0;
+    sigc::internal::tuple_for_each<tuple_summer>(t, sum);
+    do_not_optimize(sum);
+  });
+
+  auto strings = std::make_tuple(std::string(100, 'a'), std::string(100, 'b'), 1);
+  h.run("tuple/end/std::string",
+    [&]() { do_not_optimize(sigc::internal::tuple_end<2>(strings)); });
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  BenchmarkHarness h(argc, argv);
+  if (!h.ok())
+    return h.finish();
 
-  // emission benchmark (five slot) ...
-  test_connected_multiple_signal_emit();
+  bench_slot_call(h);
+  bench_emit_slot_counts(h);
+  bench_static_signal(h);
+  bench_emit_arguments(h);
+  bench_adaptors(h);
+  bench_adaptor_matrix(h);
+  bench_blocked(h);
+  bench_nested(h);
+  bench_connect_disconnect(h);
+  bench_churn(h);
+  bench_reference_dispatch(h);
+  bench_tuple_utils(h);
 
-  // connection / disconnection benchmark ...
-  test_connect_disconnect();
+  return h.finish();
 }
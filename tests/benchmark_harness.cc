@@ -0,0 +1,552 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "benchmark_harness.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+bool
+parse_option(const std::string& arg, const std::string& name, std::string& value)
+{
+  const auto prefix = "--" + name + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0)
+    return false;
+  value = arg.substr(prefix.size());
+  return true;
+}
+
+// Returns the value of a string or number field in a line of JSON, or "".
+std::string
+json_field(const std::string& line, const std::string& name)
+{
+  const auto key = "\"" + name + "\": ";
+  auto pos = line.find(key);
+  if (pos == std::string::npos)
+    return std::string();
+  pos += key.size();
+  if (line[pos] == '"')
+    return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+  return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+// Reads the ns/op of each benchmark from a file written by --json.
+bool
+read_baseline(const std::string& filename, std::map<std::string, double>& baseline)
+{
+  std::ifstream file(filename);
+  if (!file)
+    return false;
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    const auto name = json_field(line, "name");
+    const auto ns_per_op = json_field(line, "ns_per_op");
+    if (!name.empty() && !ns_per_op.empty())
+      baseline[name] = std::strtod(ns_per_op.c_str(), nullptr);
+  }
+  return true;
+}
+
+// The column heading of a percentile, such as "p99.9".
+std::string
+percentile_label(double percent)
+{
+  if (percent >= 100.0)
+    return "max";
+  std::ostringstream label;
+  label << "p" << percent;
+  return label.str();
+}
+
+} // anonymous namespace
+
+double
+CycleClock::ns_per_tick()
+{
+  static const double result = []() {
+    using clock = std::chrono::steady_clock;
+    const auto start_time = clock::now();
+    const auto start_ticks = now();
+    while (clock::now() - start_time < std::chrono::milliseconds(20))
+    {
+    }
+    const auto ticks = now() - start_ticks;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start_time);
+    return ticks > 0 ? static_cast<double>(ns.count()) / ticks : 1.0;
+  }();
+  return result;
+}
+
+LatencyHistogram::LatencyHistogram()
+: buckets_((64 - sub_bucket_bits + 1) * sub_bucket_count), count_(0), max_(0)
+{
+}
+
+std::size_t
+LatencyHistogram::bucket_index(std::uint64_t value)
+{
+  if (value < 2 * sub_bucket_count)
+    return static_cast<std::size_t>(value);
+
+  unsigned highest_bit = 0;
+  for (auto v = value; v >>= 1;)
+    ++highest_bit;
+  const unsigned shift = highest_bit - sub_bucket_bits;
+  return static_cast<std::size_t>((shift + 1) * sub_bucket_count + (value >> shift) - sub_bucket_count);
+}
+
+std::uint64_t
+LatencyHistogram::bucket_highest(std::size_t index)
+{
+  if (index < 2 * sub_bucket_count)
+    return index;
+
+  const auto shift = index / sub_bucket_count - 1;
+  const auto sub_bucket = index % sub_bucket_count + sub_bucket_count;
+  // Wraps around to the largest value for the last bucket.
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+void
+LatencyHistogram::record(std::uint64_t value)
+{
+  ++buckets_[bucket_index(value)];
+  ++count_;
+  max_ = std::max(max_, value);
+}
+
+std::uint64_t
+LatencyHistogram::percentile(double percent) const
+{
+  if (count_ == 0)
+    return 0;
+
+  const auto rank = std::max<std::uint64_t>(
+    1, static_cast<std::uint64_t>(std::ceil(percent / 100.0 * count_)));
+  std::uint64_t seen = 0;
+  for (std::size_t i = 0; i < buckets_.size(); ++i)
+  {
+    seen += buckets_[i];
+    if (seen >= rank)
+      return std::min(bucket_highest(i), max_);
+  }
+  return max_;
+}
+
+PerfCounters::PerfCounters()
+{
+#ifdef __linux__
+  struct counter
+  {
+    std::uint32_t type;
+    std::uint64_t config;
+  };
+  const counter counters[] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+  };
+
+  for (const auto& c : counters)
+  {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = c.type;
+    attr.config = c.config;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // Counting only user space is allowed with perf_event_paranoid <= 2.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0 && error_.empty())
+      error_ = std::string("perf_event_open() failed: ") + std::strerror(errno);
+    fds_.push_back(fd);
+  }
+#else
+  error_ = "Hardware performance counters are only supported on Linux.";
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+  for (const int fd : fds_)
+  {
+    if (fd >= 0)
+      close(fd);
+  }
+#endif
+}
+
+const std::vector<std::string>&
+PerfCounters::names()
+{
+  static const std::vector<std::string> result = { "cycles", "instructions", "l1d_misses",
+    "llc_misses", "branch_misses" };
+  return result;
+}
+
+bool
+PerfCounters::available() const
+{
+  for (const int fd : fds_)
+  {
+    if (fd >= 0)
+      return true;
+  }
+  return false;
+}
+
+std::vector<PerfCounters::Reading>
+PerfCounters::read() const
+{
+  std::vector<Reading> readings(names().size(), Reading{ 0, 0, 0 });
+#ifdef __linux__
+  for (std::size_t i = 0; i < fds_.size(); ++i)
+  {
+    std::uint64_t values[3];
+    if (fds_[i] >= 0 && ::read(fds_[i], values, sizeof(values)) == sizeof(values))
+      readings[i] = Reading{ values[0], values[1], values[2] };
+  }
+#endif
+  return readings;
+}
+
+std::vector<double>
+PerfCounters::per_op(const std::vector<Reading>& before, const std::vector<Reading>& after,
+  std::uint64_t operations)
+{
+  std::vector<double> result;
+  for (std::size_t i = 0; i < before.size() && i < after.size(); ++i)
+  {
+    const auto running = after[i].time_running - before[i].time_running;
+    if (running == 0 || operations == 0)
+    {
+      result.push_back(-1.0);
+      continue;
+    }
+    const auto enabled = after[i].time_enabled - before[i].time_enabled;
+    const double value = static_cast<double>(after[i].value - before[i].value);
+    result.push_back(value * enabled / running / operations);
+  }
+  return result;
+}
+
+BenchmarkHarness::ThreadTeam::ThreadTeam(unsigned threads, work_type work)
+: work_(std::move(work)), round_(0), iterations_(0), running_(0), allocations_(0), stop_(false)
+{
+  for (unsigned t = 0; t < threads; ++t)
+    threads_.emplace_back(&ThreadTeam::thread_main, this, t);
+}
+
+BenchmarkHarness::ThreadTeam::~ThreadTeam()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+BenchmarkHarness::Sample
+BenchmarkHarness::ThreadTeam::run_round(std::uint64_t iterations)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  iterations_ = iterations;
+  running_ = static_cast<unsigned>(threads_.size());
+  allocations_ = 0;
+  ++round_;
+  const auto start = clock::now();
+  start_.notify_all();
+  done_.wait(lock, [this]() { return running_ == 0; });
+  const auto elapsed = clock::now() - start;
+  return { static_cast<std::uint64_t>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+    allocations_ };
+}
+
+void
+BenchmarkHarness::ThreadTeam::thread_main(unsigned thread)
+{
+  std::uint64_t last_round = 0;
+  for (;;)
+  {
+    std::uint64_t iterations;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [&]() { return stop_ || round_ != last_round; });
+      if (stop_)
+        return;
+      last_round = round_;
+      iterations = iterations_;
+    }
+
+    const AllocationCounter allocations;
+    work_(thread, iterations);
+    const auto count = allocations.count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    allocations_ += count;
+    if (--running_ == 0)
+      done_.notify_one();
+  }
+}
+
+const std::vector<double> BenchmarkHarness::latency_percentiles = { 50.0, 90.0, 99.0, 99.9,
+  100.0 };
+
+BenchmarkHarness::BenchmarkHarness(int argc, char* argv[])
+: ok_(true), list_(false), latency_(false), min_time_ns_(200000000), repetitions_(3),
+  max_threads_(std::max(1u, std::thread::hardware_concurrency())), threshold_percent_(0.0)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    std::string value;
+    if (arg == "--list")
+      list_ = true;
+    else if (arg == "--latency")
+      latency_ = true;
+    else if (arg == "--perf")
+      perf_counters_.reset(new PerfCounters);
+    else if (arg == "--quick")
+    {
+      min_time_ns_ = 5000000;
+      repetitions_ = 1;
+    }
+    else if (parse_option(arg, "filter", value))
+      filter_ = value;
+    else if (parse_option(arg, "min-time", value))
+      min_time_ns_ = std::strtoull(value.c_str(), nullptr, 10) * 1000000;
+    else if (parse_option(arg, "repetitions", value))
+      repetitions_ = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+    else if (parse_option(arg, "max-threads", value))
+      max_threads_ = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+    else if (parse_option(arg, "json", value))
+      json_file_ = value;
+    else if (parse_option(arg, "baseline", value))
+      baseline_file_ = value;
+    else if (parse_option(arg, "threshold", value))
+      threshold_percent_ = std::strtod(value.c_str(), nullptr);
+    else
+    {
+      std::cerr << "Unknown option: " << arg << std::endl
+                << "Usage: " << argv[0]
+                << " [--filter=TEXT] [--list] [--min-time=MS] [--repetitions=N] [--quick]"
+                   " [--json=FILE] [--baseline=FILE] [--threshold=PCT] [--latency]"
+                   " [--perf] [--max-threads=N]"
+                << std::endl;
+      ok_ = false;
+    }
+  }
+
+  if (repetitions_ == 0)
+    repetitions_ = 1;
+  if (max_threads_ == 0)
+    max_threads_ = 1;
+  if (min_time_ns_ == 0)
+    min_time_ns_ = 1;
+
+  if (ok_ && !list_ && perf_counters_ && !perf_counters_->available())
+    std::cout << "No performance counters: " << perf_counters_->error() << std::endl;
+
+  if (ok_ && !list_)
+    print_header();
+}
+
+void
+BenchmarkHarness::print_header() const
+{
+  std::cout << std::left << std::setw(56) << "benchmark" << std::right;
+  if (latency_)
+  {
+    for (const double percent : latency_percentiles)
+      std::cout << std::setw(11) << percentile_label(percent) + " ns";
+  }
+  std::cout << std::setw(14) << (latency_ ? "mean ns" : "ns/op") << std::setw(14)
+            << "allocs/op";
+  if (perf_available())
+  {
+    for (const char* heading : { "cycles", "instrs", "L1D miss", "LLC miss", "br miss" })
+      std::cout << std::setw(11) << heading;
+  }
+  std::cout << std::endl;
+}
+
+std::uint64_t
+BenchmarkHarness::timer_overhead_ticks()
+{
+  static const std::uint64_t result = []() {
+    auto overhead = ~std::uint64_t(0);
+    for (int i = 0; i < 10000; ++i)
+    {
+      const auto begin = CycleClock::now();
+      const auto ticks = CycleClock::now() - begin;
+      overhead = std::min(overhead, ticks);
+    }
+    return overhead;
+  }();
+  return result;
+}
+
+bool
+BenchmarkHarness::selected(const std::string& name)
+{
+  if (!ok_ || name.find(filter_) == std::string::npos)
+    return false;
+
+  if (list_)
+  {
+    if (name != last_listed_)
+      std::cout << name << std::endl;
+    last_listed_ = name;
+    return false;
+  }
+  return true;
+}
+
+void
+BenchmarkHarness::add_result(Result result)
+{
+  result.metrics = std::move(metrics_);
+  metrics_.clear();
+
+  std::cout << std::left << std::setw(56) << result.name << std::right << std::fixed
+            << std::setprecision(2);
+  for (const double ns : result.latency_ns)
+    std::cout << std::setw(11) << ns;
+  std::cout << std::setw(14) << result.ns_per_op << std::setw(14) << result.allocations_per_op;
+  for (const double events : result.events_per_op)
+  {
+    if (events < 0.0)
+      std::cout << std::setw(11) << "-";
+    else
+      std::cout << std::setw(11) << events;
+  }
+  for (const auto& metric : result.metrics)
+    std::cout << "  " << metric.first << "=" << std::setprecision(0) << metric.second;
+  std::cout << std::endl;
+  results_.push_back(std::move(result));
+}
+
+void
+BenchmarkHarness::compare(const std::string& name, const std::string& reference)
+{
+  comparisons_.emplace_back(name, reference);
+}
+
+int
+BenchmarkHarness::finish()
+{
+  if (!ok_)
+    return EXIT_FAILURE;
+  if (list_)
+    return EXIT_SUCCESS;
+
+  int exit_code = EXIT_SUCCESS;
+
+  std::map<std::string, double> ns_per_op;
+  for (const auto& r : results_)
+    ns_per_op[r.name] = r.ns_per_op;
+  bool comparison_header = false;
+  for (const auto& comparison : comparisons_)
+  {
+    const auto name = ns_per_op.find(comparison.first);
+    const auto reference = ns_per_op.find(comparison.second);
+    if (name == ns_per_op.end() || reference == ns_per_op.end() || reference->second <= 0.0)
+      continue;
+
+    if (!comparison_header)
+      std::cout << std::endl << "overhead factors" << std::endl;
+    comparison_header = true;
+    std::cout << "  " << std::fixed << std::setprecision(2) << std::setw(8)
+              << name->second / reference->second << "x  " << comparison.first << " vs "
+              << comparison.second << std::endl;
+  }
+
+  if (!json_file_.empty())
+  {
+    std::ofstream file(json_file_);
+    file << "{\"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results_.size(); ++i)
+    {
+      const auto& r = results_[i];
+      file << "{\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+           << ", \"ns_per_op\": " << r.ns_per_op
+           << ", \"allocations_per_op\": " << r.allocations_per_op;
+      for (std::size_t p = 0; p < r.latency_ns.size(); ++p)
+        file << ", \"" << percentile_label(latency_percentiles[p]) << "_ns\": " << r.latency_ns[p];
+      for (std::size_t e = 0; e < r.events_per_op.size(); ++e)
+      {
+        if (r.events_per_op[e] >= 0.0)
+          file << ", \"" << PerfCounters::names()[e] << "_per_op\": " << r.events_per_op[e];
+      }
+      for (const auto& metric : r.metrics)
+        file << ", \"" << metric.first << "\": " << metric.second;
+      file << "}"
+           << (i + 1 < results_.size() ? ",\n" : "\n");
+    }
+    file << "]}\n";
+    if (!file)
+    {
+      std::cerr << "Can't write " << json_file_ << std::endl;
+      exit_code = EXIT_FAILURE;
+    }
+  }
+
+  if (!baseline_file_.empty())
+  {
+    std::map<std::string, double> baseline;
+    if (!read_baseline(baseline_file_, baseline))
+    {
+      std::cerr << "Can't read " << baseline_file_ << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << std::endl
+              << std::left << std::setw(56) << "compared with baseline" << std::right
+              << std::setw(14) << "baseline" << std::setw(14) << "change" << std::endl;
+    for (const auto& r : results_)
+    {
+      const auto it = baseline.find(r.name);
+      if (it == baseline.end() || it->second <= 0.0)
+        continue;
+
+      const double change = (r.ns_per_op / it->second - 1.0) * 100.0;
+      const bool regression = threshold_percent_ > 0.0 && change > threshold_percent_;
+      std::cout << std::left << std::setw(56) << r.name << std::right << std::fixed
+                << std::setprecision(2) << std::setw(14) << it->second << std::setw(13)
+                << std::showpos << change << std::noshowpos << "%"
+                << (regression ? "  REGRESSION" : "") << std::endl;
+      if (regression)
+        exit_code = EXIT_FAILURE;
+    }
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,420 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#ifndef SIGC_TESTS_BENCHMARK_HARNESS_H
+#define SIGC_TESTS_BENCHMARK_HARNESS_H
+
+#include "testutilities.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+// Prevents the compiler from optimizing away the computation of a value.
+template <typename T>
+inline void
+do_not_optimize(const T& value)
+{
+#if defined(__GNUC__)
+  __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+// Reads a cheap, monotonic cycle counter: the time stamp counter on x86,
+// the virtual counter on AArch64, and steady_clock everywhere else.
+// Use ns_per_tick() to convert the difference of two readings.
+class CycleClock
+{
+public:
+  static std::uint64_t now() noexcept
+  {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    std::uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+  }
+
+  // Nanoseconds per tick, measured against steady_clock on the first call.
+  static double ns_per_tick();
+};
+
+// A histogram of latencies in the style of HdrHistogram. Values below 32 are
+// counted exactly. Above that, each power of two is split into 16 buckets, so
+// that a value is known with a relative error of at most 1/16, in a fixed
+// amount of memory.
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+
+  void record(std::uint64_t value);
+
+  std::uint64_t count() const { return count_; }
+  std::uint64_t max() const { return max_; }
+
+  // The value that percent % of the recorded values do not exceed,
+  // rounded up to the end of its bucket.
+  std::uint64_t percentile(double percent) const;
+
+private:
+  static constexpr unsigned sub_bucket_bits = 4;
+  static constexpr std::uint64_t sub_bucket_count = std::uint64_t(1) << sub_bucket_bits;
+
+  static std::size_t bucket_index(std::uint64_t value);
+  static std::uint64_t bucket_highest(std::size_t index);
+
+  std::vector<std::uint64_t> buckets_;
+  std::uint64_t count_;
+  std::uint64_t max_;
+};
+
+// Hardware performance counters of the calling thread: cycles, instructions,
+// L1 data cache misses, last level cache misses and branch misses. They are
+// read with perf_event_open() on Linux. Where a counter can't be opened, for
+// instance because perf_event_paranoid forbids it, or in a virtual machine
+// without a PMU, the counter is missing. Other systems have no counters.
+class PerfCounters
+{
+public:
+  struct Reading
+  {
+    std::uint64_t value;
+    std::uint64_t time_enabled;
+    std::uint64_t time_running;
+  };
+
+  PerfCounters();
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // The names of the counters, in the order of read().
+  static const std::vector<std::string>& names();
+
+  // Whether at least one counter could be opened. If not, error() says why.
+  bool available() const;
+  const std::string& error() const { return error_; }
+
+  std::vector<Reading> read() const;
+
+  // The events per operation between two readings, scaled up if the kernel
+  // has multiplexed the counters. A missing counter gives a negative value.
+  static std::vector<double> per_op(const std::vector<Reading>& before,
+    const std::vector<Reading>& after, std::uint64_t operations);
+
+private:
+  std::vector<int> fds_;
+  std::string error_;
+};
+
+// Runs benchmarks, and reports and compares their results.
+//
+// Command line options:
+//   --filter=TEXT      Run only the benchmarks whose names contain TEXT.
+//   --list             List the benchmarks instead of running them.
+//   --min-time=MS      Time each repetition for at least MS milliseconds (default 200).
+//   --repetitions=N    Repeat each benchmark N times, and report the fastest (default 3).
+//   --quick            Same as --min-time=5 --repetitions=1.
+//   --json=FILE        Write the results to FILE as JSON.
+//   --baseline=FILE    Compare the results with a JSON file written by --json.
+//   --threshold=PCT    Fail if a benchmark is more than PCT percent slower than the baseline.
+//   --latency          Time each operation individually with CycleClock, for
+//                      min-time * repetitions, and report percentiles of the
+//                      latency. ns/op is then the mean latency.
+//   --perf             Report hardware performance counters per operation, where
+//                      the system permits it. Not with --latency or run_threads().
+//   --max-threads=N    The largest number of threads for run_threads() benchmarks
+//                      (default: the number of hardware threads).
+class BenchmarkHarness
+{
+public:
+  struct Result
+  {
+    std::string name;
+    std::uint64_t iterations;
+    double ns_per_op;
+    double allocations_per_op;
+    // With --latency, the latencies at latency_percentiles, in ns.
+    std::vector<double> latency_ns;
+    // With --perf, the events per operation of the PerfCounters.
+    std::vector<double> events_per_op;
+    // Values that the benchmark reports besides its timing.
+    std::vector<std::pair<std::string, double>> metrics;
+  };
+
+  using Metrics = std::vector<std::pair<std::string, double>>;
+
+  // The percentiles that --latency reports. 100 is the maximum.
+  static const std::vector<double> latency_percentiles;
+
+  BenchmarkHarness(int argc, char* argv[]);
+
+  // Non-copyable:
+  BenchmarkHarness(const BenchmarkHarness&) = delete;
+  BenchmarkHarness& operator=(const BenchmarkHarness&) = delete;
+
+  // Non-movable:
+  BenchmarkHarness(BenchmarkHarness&&) = delete;
+  BenchmarkHarness& operator=(BenchmarkHarness&&) = delete;
+
+  // Whether the command line has been parsed successfully.
+  bool ok() const { return ok_; }
+
+  // Whether a benchmark shall be run. Use it to skip expensive setup.
+  // With --list, it prints the name and returns false.
+  bool selected(const std::string& name);
+
+  // Measures op(), which performs one operation of the benchmark.
+  // The metrics, such as the size of an object, are reported with the result.
+  template <typename T_op>
+  void run(const std::string& name, T_op&& op, Metrics metrics = Metrics());
+
+  // Measures op(thread) called concurrently on threads threads, where thread is
+  // 0 .. threads - 1. ns/op is the wall time divided by the operations of all
+  // threads, so it halves when the throughput doubles. allocs/op includes the
+  // allocations of all threads. --latency does not apply.
+  template <typename T_op>
+  void run_threads(const std::string& name, unsigned threads, T_op&& op);
+
+  unsigned max_threads() const { return max_threads_; }
+
+  // Reports how many times slower the benchmark name is than the benchmark
+  // reference, once both have been run.
+  void compare(const std::string& name, const std::string& reference);
+
+  // Prints a summary, writes and compares the results as requested by the
+  // command line options, and returns the exit code of the program.
+  int finish();
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct Sample
+  {
+    std::uint64_t elapsed_ns;
+    std::uint64_t allocations;
+  };
+
+  // Threads that wait for rounds of work, so that thread creation isn't timed.
+  class ThreadTeam
+  {
+  public:
+    using work_type = std::function<void(unsigned thread, std::uint64_t iterations)>;
+
+    ThreadTeam(unsigned threads, work_type work);
+    ~ThreadTeam();
+
+    ThreadTeam(const ThreadTeam&) = delete;
+    ThreadTeam& operator=(const ThreadTeam&) = delete;
+
+    // Lets each thread do work(thread, iterations), and waits for all of them.
+    Sample run_round(std::uint64_t iterations);
+
+  private:
+    void thread_main(unsigned thread);
+
+    work_type work_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::uint64_t round_;
+    std::uint64_t iterations_;
+    unsigned running_;
+    std::uint64_t allocations_;
+    bool stop_;
+    std::vector<std::thread> threads_;
+  };
+
+  template <typename T_op>
+  static std::uint64_t time_ns(T_op& op, std::uint64_t iterations);
+
+  // Calibrates and repeats timer(iterations), which performs
+  // iterations * ops_per_iteration operations. If count_events is true, and
+  // --perf is given, reads the PerfCounters around each repetition.
+  template <typename T_timer>
+  void measure(const std::string& name, T_timer& timer, std::uint64_t ops_per_iteration,
+    bool count_events);
+
+  bool perf_available() const { return perf_counters_ && perf_counters_->available(); }
+
+  template <typename T_op>
+  void run_latency(const std::string& name, T_op& op);
+
+  // The ticks that CycleClock takes to time an empty operation.
+  static std::uint64_t timer_overhead_ticks();
+
+  void print_header() const;
+  // Prints and stores the result, with the metrics of the current benchmark.
+  void add_result(Result result);
+
+  bool ok_;
+  bool list_;
+  bool latency_;
+  std::string filter_;
+  std::string last_listed_;
+  std::uint64_t min_time_ns_;
+  unsigned repetitions_;
+  unsigned max_threads_;
+  std::string json_file_;
+  std::string baseline_file_;
+  double threshold_percent_;
+  std::unique_ptr<PerfCounters> perf_counters_;
+  Metrics metrics_;
+  std::vector<std::pair<std::string, std::string>> comparisons_;
+  std::vector<Result> results_;
+};
+
+template <typename T_op>
+std::uint64_t
+BenchmarkHarness::time_ns(T_op& op, std::uint64_t iterations)
+{
+  const auto start = clock::now();
+  for (std::uint64_t i = 0; i < iterations; ++i)
+    op();
+  const auto elapsed = clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+template <typename T_op>
+void
+BenchmarkHarness::run(const std::string& name, T_op&& op, Metrics metrics)
+{
+  if (!selected(name))
+    return;
+
+  metrics_ = std::move(metrics);
+  if (latency_)
+  {
+    run_latency(name, op);
+    return;
+  }
+
+  op();
+  auto timer = [&op](std::uint64_t iterations) {
+    const AllocationCounter allocations;
+    const auto elapsed_ns = time_ns(op, iterations);
+    return Sample{ elapsed_ns, allocations.count() };
+  };
+  measure(name, timer, 1, true);
+}
+
+template <typename T_op>
+void
+BenchmarkHarness::run_threads(const std::string& name, unsigned threads, T_op&& op)
+{
+  if (!selected(name))
+    return;
+
+  ThreadTeam team(threads, [&op](unsigned thread, std::uint64_t iterations) {
+    for (std::uint64_t i = 0; i < iterations; ++i)
+      op(thread);
+  });
+  team.run_round(1);
+  auto timer = [&team](std::uint64_t iterations) { return team.run_round(iterations); };
+  measure(name, timer, threads, false);
+}
+
+template <typename T_timer>
+void
+BenchmarkHarness::measure(const std::string& name, T_timer& timer, std::uint64_t ops_per_iteration,
+  bool count_events)
+{
+  count_events = count_events && perf_available();
+
+  // Find a number of iterations that takes at least min_time_ns_.
+  std::uint64_t iterations = 1;
+  for (;;)
+  {
+    const auto elapsed = timer(iterations).elapsed_ns;
+    if (elapsed >= min_time_ns_ || iterations >= (std::uint64_t(1) << 40))
+      break;
+    if (elapsed < min_time_ns_ / 100)
+      iterations *= 10;
+    else
+      iterations = static_cast<std::uint64_t>(1.1 * iterations * min_time_ns_ / elapsed) + 1;
+  }
+
+  const auto operations = iterations * ops_per_iteration;
+  Result result = { name, operations, 0.0, 0.0, {}, {}, {} };
+  std::vector<PerfCounters::Reading> before;
+  for (unsigned r = 0; r < repetitions_; ++r)
+  {
+    if (count_events)
+      before = perf_counters_->read();
+    const auto sample = timer(iterations);
+    const double ns_per_op = static_cast<double>(sample.elapsed_ns) / operations;
+    if (r == 0 || ns_per_op < result.ns_per_op)
+    {
+      result.ns_per_op = ns_per_op;
+      if (count_events)
+        result.events_per_op = PerfCounters::per_op(before, perf_counters_->read(), operations);
+    }
+    result.allocations_per_op = static_cast<double>(sample.allocations) / operations;
+  }
+  add_result(result);
+}
+
+template <typename T_op>
+void
+BenchmarkHarness::run_latency(const std::string& name, T_op& op)
+{
+  const auto overhead = timer_overhead_ticks();
+  const auto duration = std::chrono::nanoseconds(min_time_ns_ * repetitions_);
+
+  op();
+  LatencyHistogram histogram;
+  std::uint64_t total_ticks = 0;
+  const AllocationCounter allocations;
+  const auto start = clock::now();
+  do
+  {
+    // Look at the clock only now and then, between the timed operations.
+    for (int i = 0; i < 64; ++i)
+    {
+      const auto begin = CycleClock::now();
+      op();
+      const auto ticks = CycleClock::now() - begin;
+      const auto latency = ticks > overhead ? ticks - overhead : 0;
+      histogram.record(latency);
+      total_ticks += latency;
+    }
+  } while (clock::now() - start < duration);
+  const auto allocation_count = allocations.count();
+
+  const double ns_per_tick = CycleClock::ns_per_tick();
+  const auto count = histogram.count();
+  Result result = { name, count, ns_per_tick * total_ticks / count,
+    static_cast<double>(allocation_count) / count, {}, {}, {} };
+  for (const double percent : latency_percentiles)
+    result.latency_ns.push_back(ns_per_tick * histogram.percentile(percent));
+  add_result(result);
+}
+
+#endif /* SIGC_TESTS_BENCHMARK_HARNESS_H */
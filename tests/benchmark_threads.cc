@@ -0,0 +1,174 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+// Measures how emission, connection and trackable destruction scale with the
+// number of threads. A signal is not thread-safe, so each scenario guards a
+// signal that is used by more than one thread with a mutex. Whatever remains
+// shared between the threads, such as the heap, shows up as lost scalability.
+// Scenarios for concurrent signal types belong here too.
+
+#include "benchmark_harness.h"
+#include <sigc++/sigc++.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct foo : public sigc::trackable
+{
+  void baz(int a) { c += a; }
+  int c = 0;
+};
+
+// Each thread's own signal and the things that other threads hand over to it.
+// The mutex guards all of them.
+struct lane
+{
+  std::mutex mutex;
+  sigc::signal<void(int)> signal;
+  std::vector<sigc::connection> connections;
+  std::vector<std::unique_ptr<foo>> foos;
+};
+
+std::vector<unsigned>
+thread_counts(unsigned max_threads)
+{
+  std::vector<unsigned> counts;
+  for (unsigned n = 1; n < max_threads; n *= 2)
+    counts.push_back(n);
+  counts.push_back(max_threads);
+  return counts;
+}
+
+std::string
+suffix(unsigned threads)
+{
+  return "/threads:" + std::to_string(threads);
+}
+
+// Each thread emits its own signal, which has 5 slots.
+void
+bench_independent(BenchmarkHarness& h, unsigned threads)
+{
+  const auto name = "emit/independent" + suffix(threads);
+  if (!h.selected(name))
+    return;
+
+  std::vector<std::unique_ptr<lane>> lanes;
+  std::vector<std::unique_ptr<foo>> foos;
+  for (unsigned t = 0; t < threads; ++t)
+  {
+    lanes.emplace_back(new lane);
+    for (int i = 0; i < 5; ++i)
+    {
+      foos.emplace_back(new foo);
+      lanes.back()->signal.connect(sigc::mem_fun(*foos.back(), &foo::baz));
+    }
+  }
+
+  h.run_threads(name, threads, [&lanes](unsigned thread) { lanes[thread]->signal.emit(1); });
+}
+
+// All threads emit the same signal, which has 5 slots.
+void
+bench_shared(BenchmarkHarness& h, unsigned threads)
+{
+  const auto name = "emit/shared" + suffix(threads);
+  if (!h.selected(name))
+    return;
+
+  lane shared;
+  std::vector<std::unique_ptr<foo>> foos;
+  for (int i = 0; i < 5; ++i)
+  {
+    foos.emplace_back(new foo);
+    shared.signal.connect(sigc::mem_fun(*foos.back(), &foo::baz));
+  }
+
+  h.run_threads(name, threads, [&shared](unsigned) {
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.signal.emit(1);
+  });
+}
+
+// Each thread connects a slot to its own signal, and disconnects the slots
+// that the previous thread has connected to the previous thread's signal.
+void
+bench_cross_thread_disconnect(BenchmarkHarness& h, unsigned threads)
+{
+  const auto name = "connect+disconnect/cross-thread" + suffix(threads);
+  if (!h.selected(name))
+    return;
+
+  std::vector<std::unique_ptr<lane>> lanes;
+  for (unsigned t = 0; t < threads; ++t)
+    lanes.emplace_back(new lane);
+
+  h.run_threads(name, threads, [&lanes, threads](unsigned thread) {
+    {
+      auto& own = *lanes[thread];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      own.connections.push_back(own.signal.connect([](int) {}));
+    }
+
+    auto& previous = *lanes[(thread + threads - 1) % threads];
+    std::lock_guard<std::mutex> lock(previous.mutex);
+    for (auto& connection : previous.connections)
+      connection.disconnect();
+    previous.connections.clear();
+  });
+}
+
+// Each thread connects a new trackable to its own signal, and deletes the
+// trackables that the previous thread has connected to the previous thread's
+// signal.
+void
+bench_cross_thread_trackable(BenchmarkHarness& h, unsigned threads)
+{
+  const auto name = "trackable/cross-thread-destruction" + suffix(threads);
+  if (!h.selected(name))
+    return;
+
+  std::vector<std::unique_ptr<lane>> lanes;
+  for (unsigned t = 0; t < threads; ++t)
+    lanes.emplace_back(new lane);
+
+  h.run_threads(name, threads, [&lanes, threads](unsigned thread) {
+    {
+      std::unique_ptr<foo> f(new foo);
+      auto& own = *lanes[thread];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      own.signal.connect(sigc::mem_fun(*f, &foo::baz));
+      own.foos.push_back(std::move(f));
+    }
+
+    // Deleting a trackable removes its slots from the signal.
+    auto& previous = *lanes[(thread + threads - 1) % threads];
+    std::lock_guard<std::mutex> lock(previous.mutex);
+    previous.foos.clear();
+  });
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  BenchmarkHarness h(argc, argv);
+  if (!h.ok())
+    return h.finish();
+
+  for (const auto threads : thread_counts(h.max_threads()))
+  {
+    bench_independent(h, threads);
+    bench_shared(h, threads);
+    bench_cross_thread_disconnect(h, threads);
+    bench_cross_thread_trackable(h, threads);
+  }
+
+  return h.finish();
+}
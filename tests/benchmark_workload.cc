@@ -0,0 +1,248 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+// A synthetic workload that resembles a GUI application: many trackable
+// widgets, each with several signals, wired to each other at random with
+// mem_fun() slots. It runs these phases, and reports the time, the heap
+// allocations and the resident set size of each of them:
+//
+//   create      Construct the widgets.
+//   connect     Connect 0 to 2 random widgets to each signal of each widget.
+//   emit        Emit random signals. Each handler re-emits a random signal of
+//               its own widget, up to a nesting depth of 3.
+//   disconnect  Like emit, but each handler disconnects a random connection
+//               with a probability of 1/4, which is often the connection of a
+//               slot in the signal that is being emitted.
+//   teardown    Destroy the connections and the widgets in random order.
+//
+// Command line options:
+//   --widgets=N    Number of widgets (default 100000).
+//   --emissions=N  Number of emissions in the emit phase (default 200000).
+//                  The disconnect phase emits a quarter as often.
+//   --seed=N       Seed of the random number generator (default 1).
+
+#include "testutilities.h"
+#include <sigc++/sigc++.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <fstream>
+#endif
+
+namespace
+{
+
+const int max_depth = 3;
+
+class widget;
+
+struct workload
+{
+  std::mt19937 engine;
+  std::vector<std::unique_ptr<widget>> widgets;
+  std::vector<sigc::connection> connections;
+  bool disconnecting = false;
+  std::uint64_t handler_calls = 0;
+  std::uint64_t disconnections = 0;
+
+  // A random number in [0, n).
+  std::size_t random(std::size_t n)
+  {
+    return std::uniform_int_distribution<std::size_t>(0, n - 1)(engine);
+  }
+
+  void disconnect_random()
+  {
+    if (connections.empty())
+      return;
+    const auto i = random(connections.size());
+    connections[i].disconnect();
+    connections[i] = connections.back();
+    connections.pop_back();
+    ++disconnections;
+  }
+};
+
+class widget : public sigc::trackable
+{
+public:
+  widget(workload& w, std::size_t signal_count) : workload_(w), signals_(signal_count) {}
+
+  std::vector<sigc::signal<void(int)>>& signals() { return signals_; }
+
+  void on_event(int depth)
+  {
+    ++workload_.handler_calls;
+    if (workload_.disconnecting && workload_.random(4) == 0)
+      workload_.disconnect_random();
+    if (depth < max_depth)
+      signals_[workload_.random(signals_.size())].emit(depth + 1);
+  }
+
+private:
+  workload& workload_;
+  std::vector<sigc::signal<void(int)>> signals_;
+};
+
+// The resident set size in bytes, or 0 where it is unknown.
+std::uint64_t
+current_rss()
+{
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  std::uint64_t size = 0;
+  std::uint64_t resident = 0;
+  if (statm >> size >> resident)
+    return resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+  return 0;
+}
+
+// The largest resident set size so far in bytes, or 0 where it is unknown.
+std::uint64_t
+peak_rss()
+{
+#if defined(__unix__) || defined(__APPLE__)
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    return static_cast<std::uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+std::string
+megabytes(std::uint64_t bytes)
+{
+  if (bytes == 0)
+    return "-";
+  const auto tenths = (bytes * 10 + 512 * 1024) / (1024 * 1024);
+  return std::to_string(tenths / 10) + "." + std::to_string(tenths % 10);
+}
+
+template <typename T_phase>
+void
+run_phase(const std::string& name, T_phase phase)
+{
+  const AllocationCounter allocations;
+  const auto start = std::chrono::steady_clock::now();
+  phase();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const auto allocation_count = allocations.count();
+
+  std::cout << std::left << std::setw(14) << name << std::right << std::setw(12)
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+            << std::setw(14) << allocation_count << std::setw(12) << megabytes(current_rss())
+            << std::setw(12) << megabytes(peak_rss()) << std::endl;
+}
+
+bool
+parse_option(const std::string& arg, const std::string& name, unsigned long& value)
+{
+  const auto prefix = "--" + name + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0)
+    return false;
+  value = std::strtoul(arg.c_str() + prefix.size(), nullptr, 10);
+  return true;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  unsigned long widget_count = 100000;
+  unsigned long emissions = 200000;
+  unsigned long seed = 1;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (!parse_option(arg, "widgets", widget_count) &&
+        !parse_option(arg, "emissions", emissions) && !parse_option(arg, "seed", seed))
+    {
+      std::cerr << "Unknown option: " << arg << std::endl
+                << "Usage: " << argv[0] << " [--widgets=N] [--emissions=N] [--seed=N]"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (widget_count == 0)
+    widget_count = 1;
+
+  workload w;
+  w.engine.seed(static_cast<std::mt19937::result_type>(seed));
+
+  std::cout << std::left << std::setw(14) << "phase" << std::right << std::setw(12) << "ms"
+            << std::setw(14) << "allocations" << std::setw(12) << "RSS MB" << std::setw(12)
+            << "peak RSS MB" << std::endl;
+
+  run_phase("create", [&]() {
+    for (unsigned long i = 0; i < widget_count; ++i)
+      w.widgets.emplace_back(new widget(w, 5 + w.random(16)));
+  });
+
+  run_phase("connect", [&]() {
+    for (auto& source : w.widgets)
+    {
+      for (auto& signal : source->signals())
+      {
+        for (auto n = w.random(3); n > 0; --n)
+        {
+          auto& target = *w.widgets[w.random(w.widgets.size())];
+          w.connections.push_back(signal.connect(sigc::mem_fun(target, &widget::on_event)));
+        }
+      }
+    }
+  });
+  const auto connection_count = w.connections.size();
+
+  const auto emit_random = [&w]() {
+    auto& source = *w.widgets[w.random(w.widgets.size())];
+    source.signals()[w.random(source.signals().size())].emit(0);
+  };
+
+  run_phase("emit", [&]() {
+    for (unsigned long i = 0; i < emissions; ++i)
+      emit_random();
+  });
+
+  run_phase("disconnect", [&]() {
+    w.disconnecting = true;
+    for (unsigned long i = 0; i < emissions / 4; ++i)
+      emit_random();
+    w.disconnecting = false;
+  });
+
+  run_phase("teardown", [&]() {
+    w.connections.clear();
+    std::shuffle(w.widgets.begin(), w.widgets.end(), w.engine);
+    for (auto& target : w.widgets)
+      target.reset();
+    w.widgets.clear();
+  });
+
+  std::cout << std::endl
+            << "widgets: " << widget_count << ", connections: " << connection_count
+            << ", handler calls: " << w.handler_calls
+            << ", disconnections: " << w.disconnections << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+// Compiled to assembly by codegen_compare.sh, which checks that each
+// adapted_* function compiles to the same code as its lambda_* counterpart.
+// The adaptors must forward the arguments straight into the call, without
+// temporary copies. A static_signal must call its functors directly.
+
+#include <sigc++/static_signal.h>
+#include <sigc++/adaptors/bind.h>
+#include <sigc++/adaptors/hide.h>
+#include <sigc++/adaptors/retype.h>
+#include <sigc++/functors/mem_fun.h>
+#include <sigc++/functors/ptr_fun.h>
+#include <sigc++/trackable.h>
+#include <string>
+#include <utility>
+
+struct widget : public sigc::trackable
+{
+  int on_event(int a, std::string s, long b);
+  int on_name(const std::string& name, int a);
+  void on_changed(const std::string& name);
+};
+
+long scale(long a, double b);
+int log_name(const std::string& name, int a);
+
+extern "C" {
+
+int
+adapted_bind(widget& w, int a, std::string& s)
+{
+  return sigc::bind(sigc::mem_fun(w, &widget::on_event), 5L)(a, std::move(s));
+}
+
+int
+lambda_bind(widget& w, int a, std::string& s)
+{
+  return [&w](int a, std::string&& s) { return w.on_event(a, std::move(s), 5L); }(
+    a, std::move(s));
+}
+
+int
+adapted_bind_location(widget& w, const std::string& name)
+{
+  return sigc::bind<1>(sigc::mem_fun(w, &widget::on_name), 7)(name);
+}
+
+int
+lambda_bind_location(widget& w, const std::string& name)
+{
+  return [&w](const std::string& name) { return w.on_name(name, 7); }(name);
+}
+
+int
+adapted_hide(widget& w, int a, std::string& s, double d)
+{
+  return sigc::hide<2>(sigc::mem_fun(w, &widget::on_event))(a, std::move(s), d, 5L);
+}
+
+int
+lambda_hide(widget& w, int a, std::string& s, double d)
+{
+  return [&w](int a, std::string&& s, double, long b) {
+    return w.on_event(a, std::move(s), b);
+  }(a, std::move(s), d, 5L);
+}
+
+long
+adapted_retype(int a, float b)
+{
+  return sigc::retype(sigc::ptr_fun(&scale))(a, b);
+}
+
+long
+lambda_retype(int a, float b)
+{
+  return [](int a, float b) { return scale(a, b); }(a, b);
+}
+
+int
+adapted_static_signal(widget& w, const std::string& name)
+{
+  const sigc::static_signal changed(
+    sigc::mem_fun<&widget::on_changed>(w), sigc::bind(sigc::ptr_fun<&log_name>(), 3));
+  return changed.emit(name);
+}
+
+int
+lambda_static_signal(widget& w, const std::string& name)
+{
+  w.on_changed(name);
+  return log_name(name, 3);
+}
+
+} // extern "C"
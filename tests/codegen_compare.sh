@@ -0,0 +1,75 @@
+#!/bin/bash
+
+# Check that libsigc++ adaptors compile to the same code as hand-written lambdas.
+#
+# Compiles SOURCE to assembly and compares the body of each function
+# adapted_NAME with the body of the function lambda_NAME. The local labels
+# are renumbered before the comparison. Fails if any pair differs.
+#
+# Usage: codegen_compare.sh SOURCE -- COMPILER [FLAGS...]
+# FLAGS must contain the include paths of libsigc++ and of sigc++config.h,
+# and an optimization level. With GCC, add -fno-ipa-icf, so that identical
+# functions are not merged.
+#
+# Example, in the source directory of an in-tree build:
+#   tests/codegen_compare.sh tests/codegen_bind.cc -- g++ -std=c++17 -O2 -fno-ipa-icf -I. -I_build
+
+if [ $# -lt 3 ] || [ "$2" != "--" ]
+then
+  echo "Usage: $0 SOURCE -- COMPILER [FLAGS...]" >&2
+  exit 1
+fi
+
+source="$1"
+shift 2
+
+asm=$("$@" -S -o - "$source") || exit 1
+
+# Prints the instructions of function $1, with the local labels renumbered.
+function_body()
+{
+  echo "$asm" | awk -v name="$1" '
+    $0 == name ":" { inside = 1; next }
+    inside && /\.cfi_endproc|^\t\.size/ { exit }
+    inside && !/^\t\./ && !/^\.Lfunc/ {
+      line = $0
+      while (match(line, /\.L[A-Za-z_]*[0-9]+/))
+      {
+        label = substr(line, RSTART, RLENGTH)
+        if (!(label in labels))
+          labels[label] = ".L" ++count
+        out = out substr(line, 1, RSTART - 1) labels[label]
+        line = substr(line, RSTART + RLENGTH)
+      }
+      print out line
+      out = ""
+    }'
+}
+
+names=$(echo "$asm" | sed -n 's/^_\{0,1\}adapted_\([A-Za-z0-9_]*\):$/\1/p')
+if [ -z "$names" ]
+then
+  echo "No adapted_* functions found in $source" >&2
+  exit 1
+fi
+
+# Some platforms prefix C symbols with an underscore.
+prefix=""
+echo "$asm" | grep -q '^_adapted_' && prefix="_"
+
+status=0
+for name in $names
+do
+  adapted=$(function_body "${prefix}adapted_$name")
+  lambda=$(function_body "${prefix}lambda_$name")
+  if [ -z "$adapted" ] || [ "$adapted" != "$lambda" ]
+  then
+    echo "FAIL: $name"
+    diff <(echo "$adapted") <(echo "$lambda") | sed 's/^/  /'
+    status=1
+  else
+    echo "OK: $name ($(echo "$adapted" | wc -l) lines)"
+  fi
+done
+
+exit $status
@@ -0,0 +1,206 @@
+#!/bin/bash
+
+# Measure the compile time and the code size of libsigc++ template instantiations.
+#
+# Generates translation units with distinct signal signatures and adaptor
+# combinations, compiles each of them, and reports the compile time, the
+# size of the code in each object file, and the size of the code per
+# libsigc++ template family (signal_emit, slot_call, typed_slot_rep, the
+# adaptors, the tuple utilities and so on), summed over all object files.
+#
+# Usage: compile_benchmark.sh [-n COUNT] [-o DIR] -- COMPILER [FLAGS...]
+#   -n COUNT  Number of translation units (default 10).
+#   -o DIR    Where to generate and compile them (default compile_benchmark).
+# FLAGS must contain the include paths of libsigc++ and of sigc++config.h.
+#
+# Example, in the source directory of an in-tree build:
+#   tests/compile_benchmark.sh -n 20 -- g++ -std=c++17 -O2 -I. -I_build
+
+count=10
+dir=compile_benchmark
+
+while [ $# -gt 0 ]
+do
+  case "$1" in
+    -n) count="$2"; shift 2 ;;
+    -o) dir="$2"; shift 2 ;;
+    --) shift; break ;;
+    *) echo "Unknown option: $1" >&2; exit 1 ;;
+  esac
+done
+
+if [ $# -eq 0 ]
+then
+  echo "Usage: $0 [-n COUNT] [-o DIR] -- COMPILER [FLAGS...]" >&2
+  exit 1
+fi
+
+mkdir -p "$dir" || exit 1
+
+# Writes a translation unit whose templates are all instantiated with its own types.
+generate()
+{
+  local i="$1"
+  cat <<EOF
+#include <sigc++/sigc++.h>
+#include <sigc++/tuple-utils/tuple_cdr.h>
+#include <sigc++/tuple-utils/tuple_end.h>
+#include <sigc++/tuple-utils/tuple_for_each.h>
+#include <sigc++/tuple-utils/tuple_start.h>
+#include <sigc++/tuple-utils/tuple_transform_each.h>
+
+namespace
+{
+struct arg_$i
+{
+  int value;
+};
+
+struct receiver_$i : public sigc::trackable
+{
+  int on_event(arg_$i a, int b) { return a.value + b + $i; }
+};
+
+int handle_$i(arg_$i a, int b) { return a.value * b; }
+int add_$i(arg_$i a, int b, long c) { return a.value + b + static_cast<int>(c); }
+double scale_$i(arg_$i a, int b) { return a.value * 0.5 + b; }
+int twice_$i(int a) { return 2 * a + $i; }
+void notify_$i() {}
+
+template <typename T_element>
+struct copy_$i
+{
+  static T_element transform(T_element& element) { return element; }
+};
+
+template <typename T_element>
+struct count_$i
+{
+  static void visit(const T_element&, int& count) { ++count; }
+};
+} // anonymous namespace
+
+int
+tuples_$i(int n)
+{
+  auto t = std::make_tuple(arg_$i{ n }, n, ${i}L, 0.5, arg_$i{ $i }, 'c', n, 1.5f);
+  auto start = sigc::internal::tuple_start<6>(t);
+  auto end = sigc::internal::tuple_end<6>(t);
+  auto cdr = sigc::internal::tuple_cdr(t);
+  auto copy = sigc::internal::tuple_transform_each<copy_$i>(t);
+  int count = 0;
+  sigc::internal::tuple_for_each<count_$i>(copy, count);
+  return std::get<0>(start).value + std::get<0>(end) + static_cast<int>(std::get<0>(cdr)) + count;
+}
+
+int
+run_$i(int n)
+{
+  receiver_$i receiver;
+  sigc::signal<int(arg_$i, int)> signal;
+  signal.connect(sigc::ptr_fun(&handle_$i));
+  signal.connect(sigc::mem_fun(receiver, &receiver_$i::on_event));
+  signal.connect(sigc::bind(sigc::ptr_fun(&add_$i), ${i}L));
+  signal.connect(sigc::hide<0>(sigc::ptr_fun(&twice_$i)));
+  signal.connect(sigc::retype_return<int>(sigc::ptr_fun(&scale_$i)));
+  signal.connect(sigc::compose(sigc::ptr_fun(&twice_$i), sigc::ptr_fun(&handle_$i)));
+  signal.connect(sigc::track_obj([n](arg_$i a, int b) { return a.value + b + n; }, receiver));
+
+  sigc::signal<void(arg_$i)> void_signal;
+  void_signal.connect(sigc::hide(sigc::ptr_fun(&notify_$i)));
+  void_signal.emit(arg_$i{ n });
+
+  return signal.emit(arg_$i{ n }, n);
+}
+EOF
+}
+
+now_ms()
+{
+  echo $(( $(date +%s%N) / 1000000 ))
+}
+
+# Sums the sizes of the code symbols of the object files per template family.
+symbol_families()
+{
+  nm -C -S --size-sort -t d "$@" | awk '
+    BEGIN {
+      n = split("sigc::internal::signal_emit sigc::internal::slot_call " \
+        "sigc::internal::typed_slot_rep sigc::bind_functor sigc::hide_functor " \
+        "sigc::retype_functor sigc::retype_return_functor sigc::compose1_functor " \
+        "sigc::compose2_functor sigc::track_obj_functor sigc::exception_catch_functor " \
+        "sigc::visitor sigc::visit_each " \
+        "sigc::signal sigc::slot sigc::pointer_functor sigc::bound_mem_functor " \
+        "sigc::adaptor_functor sigc::internal::tuple_ sigc::internal::detail::tuple_", families, " ")
+    }
+    $3 ~ /^[tTwW]$/ {
+      name = $0
+      sub(/^[^ ]+ [^ ]+ [^ ]+ /, "", name)
+      family = "other"
+      best = 0
+      for (f = 1; f <= n; ++f)
+      {
+        pos = index(name, families[f])
+        if (pos > 0 && (best == 0 || pos < best))
+        {
+          best = pos
+          family = families[f]
+        }
+      }
+      if (family == "other" && index(name, "sigc::") > 0)
+        family = "sigc::(other)"
+      size[family] += $2
+      symbols[family] += 1
+    }
+    END {
+      for (family in size)
+        printf "%10d %8d  %s\n", size[family], symbols[family], family
+    }' | sort -n -r
+}
+
+objects=()
+total_ms=0
+total_text=0
+
+printf "%-24s %12s %12s\n" "translation unit" "compile ms" "text bytes"
+
+# A translation unit that only includes the headers, as a reference.
+for i in base $(seq 1 "$count")
+do
+  source="$dir/tu_$i.cc"
+  object="$dir/tu_$i.o"
+  if [ "$i" = base ]
+  then
+    echo "#include <sigc++/sigc++.h>" > "$source"
+  else
+    generate "$i" > "$source"
+  fi
+
+  start=$(now_ms)
+  "$@" -c "$source" -o "$object" || exit 1
+  elapsed=$(( $(now_ms) - start ))
+  text=$(size "$object" | awk 'NR == 2 { print $1 }')
+  printf "%-24s %12d %12d\n" "tu_$i" "$elapsed" "$text"
+
+  if [ "$i" != base ]
+  then
+    objects+=("$object")
+    total_ms=$(( total_ms + elapsed ))
+    total_text=$(( total_text + text ))
+  else
+    base_ms=$elapsed
+    base_text=$text
+  fi
+done
+
+echo
+echo "Generated translation units: $count"
+echo "Mean compile time: $(( total_ms / count )) ms (headers only: $base_ms ms)"
+echo "Mean text size: $(( total_text / count )) bytes (headers only: $base_text bytes)"
+echo
+printf "%10s %8s  %s\n" "text bytes" "symbols" "template family"
+symbol_families "${objects[@]}"
+echo
+echo "Largest symbols:"
+nm -C -S --size-sort -t d "${objects[@]}" | awk '$3 ~ /^[tTwW]$/' | sort -n -r -k2 | head -10 |
+  awk '{ size = $2; sub(/^[^ ]+ [^ ]+ [^ ]+ /, ""); printf "%10d  %s\n", size, substr($0, 1, 150) }'
@@ -0,0 +1,99 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#ifndef SIGC_TESTS_REFERENCE_DISPATCHERS_H
+#define SIGC_TESTS_REFERENCE_DISPATCHERS_H
+
+// Minimal dispatchers that the benchmark compares with sigc::signal.
+// They do what a hand-written observer list does, and nothing more: there is
+// no tracking of the targets' lifetime, no blocking, and connecting or
+// disconnecting during an emission is not allowed.
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// A std::vector of std::function, with an id for each connection.
+template <typename T_signature>
+class function_dispatcher;
+
+template <typename... T_arg>
+class function_dispatcher<void(T_arg...)>
+{
+public:
+  using id_type = std::size_t;
+
+  template <typename T_functor>
+  id_type connect(T_functor&& functor)
+  {
+    slots_.emplace_back(next_id_, std::forward<T_functor>(functor));
+    return next_id_++;
+  }
+
+  void disconnect(id_type id)
+  {
+    const auto it = std::find_if(slots_.begin(), slots_.end(),
+      [id](const std::pair<id_type, std::function<void(T_arg...)>>& slot) {
+        return slot.first == id;
+      });
+    if (it != slots_.end())
+      slots_.erase(it);
+  }
+
+  void emit(T_arg... a) const
+  {
+    for (const auto& slot : slots_)
+      slot.second(a...);
+  }
+
+private:
+  id_type next_id_ = 0;
+  std::vector<std::pair<id_type, std::function<void(T_arg...)>>> slots_;
+};
+
+// An array of function pointers. The order of the slots isn't kept.
+template <typename T_signature, std::size_t I_capacity>
+class function_pointer_dispatcher;
+
+template <std::size_t I_capacity, typename... T_arg>
+class function_pointer_dispatcher<void(T_arg...), I_capacity>
+{
+public:
+  using function_type = void (*)(T_arg...);
+
+  // Returns false if the array is full.
+  bool connect(function_type function)
+  {
+    if (size_ == I_capacity)
+      return false;
+    slots_[size_++] = function;
+    return true;
+  }
+
+  void disconnect(function_type function)
+  {
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+      if (slots_[i] == function)
+      {
+        slots_[i] = slots_[--size_];
+        return;
+      }
+    }
+  }
+
+  void emit(T_arg... a) const
+  {
+    for (std::size_t i = 0; i < size_; ++i)
+      slots_[i](a...);
+  }
+
+private:
+  function_type slots_[I_capacity] = {};
+  std::size_t size_ = 0;
+};
+
+#endif /* SIGC_TESTS_REFERENCE_DISPATCHERS_H */
@@ -42,6 +42,20 @@ struct vector_accumulator
   }
 };
 
+// Counts the slots, without invoking them.
+struct count_accumulator
+{
+  using result_type = int;
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int n = 0;
+    for (; first != last; ++first)
+      ++n;
+    return n;
+  }
+};
+
 int
 foo(int i)
 {
@@ -128,6 +142,19 @@ test_vector_accumulator()
     result_stream, "foo: 10, A::foo: 46, bar: 12, Vector accumulator: Result (i=3): 10 46 12 ");
 }
 
+void
+test_all_slots_blocked()
+{
+  sigc::signal<int(int)>::accumulated<count_accumulator> sig;
+  sig.connect(sigc::ptr_fun(&foo));
+  sig.connect(sigc::ptr_fun(&bar));
+
+  // The accumulator sees the blocked slots, too.
+  sig.block();
+  result_stream << "Count accumulator: Result (all blocked): " << sig(1);
+  util->check_result(result_stream, "Count accumulator: Result (all blocked): 2");
+}
+
 } // end anonymous namespace
 
 int
@@ -141,6 +168,7 @@ main(int argc, char* argv[])
   test_empty_signal();
   test_mean();
   test_vector_accumulator();
+  test_all_slots_blocked();
 
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,141 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/adaptors/bind.h>
+#include <sigc++/adaptors/hide.h>
+#include <sigc++/adaptors/retype_return.h>
+#include <sigc++/functors/ptr_fun.h>
+#include <sigc++/functors/slot.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <type_traits>
+
+namespace
+{
+std::ostringstream result_stream;
+
+struct book : public sigc::trackable
+{
+  int pages = 42;
+};
+
+int
+foo(int i, int j, int k)
+{
+  result_stream << "foo(" << i << ", " << j << ", " << k << ") ";
+  return i + j + k;
+}
+
+int
+bar(int i)
+{
+  result_stream << "bar(" << i << ") ";
+  return i;
+}
+
+void
+read(int i, book& b, int j)
+{
+  result_stream << "read(" << i << ", " << b.pages << ", " << j << ") ";
+}
+
+using foo_functor = sigc::adaptor_functor<sigc::pointer_functor<int(int, int, int)>>;
+
+void
+test_bind_bind()
+{
+  // Nested binds with the same location are one bind_functor.
+  auto last = sigc::bind(sigc::bind(&foo, 3), 2);
+  static_assert(std::is_same<decltype(last), sigc::bind_functor<-1, foo_functor, int, int>>::value,
+    "bind(bind()) is not fused.");
+  last(1);
+
+  auto first = sigc::bind<0>(sigc::bind<0>(&foo, 1), 2);
+  static_assert(std::is_same<decltype(first), sigc::bind_functor<0, foo_functor, int, int>>::value,
+    "bind<0>(bind<0>()) is not fused.");
+  first(3);
+
+  auto middle = sigc::bind<1>(sigc::bind<1>(&foo, 2), 3);
+  middle(1);
+
+  // Binds with different locations are not fused.
+  auto mixed = sigc::bind<0>(sigc::bind(&foo, 3), 1);
+  static_assert(!std::is_same<decltype(mixed), sigc::bind_functor<0, foo_functor, int, int>>::value,
+    "bind<0>(bind()) is fused.");
+  mixed(2);
+}
+
+void
+test_bind_hide()
+{
+  // The bound argument would be ignored by hide().
+  auto f = sigc::bind(sigc::hide(sigc::retype_return<void>(&bar)), 2);
+  static_assert(std::is_same<decltype(f), sigc::retype_return_functor<void, int (*)(int)>>::value,
+    "bind(hide()) is not fused.");
+  f(1);
+
+  auto g = sigc::bind<0>(sigc::hide<0>(&bar), 2);
+  static_assert(std::is_same<decltype(g), sigc::adaptor_functor<sigc::pointer_functor<int(int)>>>::value,
+    "bind<0>(hide<0>()) is not fused.");
+  result_stream << g(1);
+}
+
+void
+test_retype_return()
+{
+  auto f = sigc::hide_return(sigc::hide_return(&bar));
+  static_assert(std::is_same<decltype(f), sigc::retype_return_functor<void, int (*)(int)>>::value,
+    "hide_return(hide_return()) is not fused.");
+  f(1);
+
+  auto g = sigc::retype_return<long>(sigc::retype_return<long>(&bar));
+  static_assert(std::is_same<decltype(g), sigc::retype_return_functor<long, int (*)(int)>>::value,
+    "retype_return(retype_return()) is not fused.");
+  result_stream << g(2);
+}
+
+void
+test_tracking()
+{
+  sigc::slot<void(int)> bound;
+  sigc::slot<int(int)> hidden;
+  {
+    book b;
+    // The reference is the second of the fused bound arguments.
+    bound = sigc::bind<1>(sigc::bind<1>(&read, std::ref(b)), 3);
+    // A reference is still bound, and tracked, even though it's hidden.
+    hidden = sigc::bind(sigc::hide(&bar), std::ref(b));
+    bound(1);
+    hidden(2);
+    result_stream << bound.empty() << hidden.empty() << " ";
+  }
+  result_stream << bound.empty() << hidden.empty();
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_bind_bind();
+  util->check_result(
+    result_stream, "foo(1, 2, 3) foo(1, 2, 3) foo(1, 2, 3) foo(1, 2, 3) ");
+
+  test_bind_hide();
+  util->check_result(result_stream, "bar(1) bar(1) 1");
+
+  test_retype_return();
+  util->check_result(result_stream, "bar(1) bar(2) 2");
+
+  test_tracking();
+  util->check_result(result_stream, "read(1, 42, 3) bar(2) 00 11");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,249 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <sigc++/functors/mem_fun.h>
+#include <sigc++/functors/ptr_fun.h>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Each test checks the exact number of heap allocations of an operation.
+// When a change adds an allocation to one of these operations, this test fails.
+// When a change removes one, update the budget.
+
+namespace
+{
+std::ostringstream result_stream;
+
+class Handler : public sigc::trackable
+{
+public:
+  void handle(int i) { sum_ += i; }
+  int sum_ = 0;
+};
+
+void
+free_handler(int)
+{
+}
+
+// The count is taken before anything is written to the result stream,
+// because that may allocate.
+void
+report(const std::string& what, std::uint64_t allocations)
+{
+  result_stream << what << allocations;
+}
+
+void
+test_slot_construction()
+{
+  Handler handler;
+  {
+    // Let the handler allocate its list of destroy notification callbacks.
+    sigc::slot<void(int)> slot = sigc::mem_fun(handler, &Handler::handle);
+  }
+
+  AllocationCounter counter;
+  {
+    sigc::slot<void(int)> slot = sigc::ptr_fun(&free_handler);
+    report("ptr_fun: ", counter.count());
+  }
+
+  counter.reset();
+  {
+    sigc::slot<void(int)> slot = sigc::ptr_fun<&free_handler>();
+    report(" static ptr_fun: ", counter.count());
+  }
+
+  counter.reset();
+  {
+    sigc::slot<void(int)> slot = [](int) {};
+    sigc::slot<void(int)> copy = slot;
+    report(" lambda and copy: ", counter.count());
+  }
+
+  counter.reset();
+  {
+    sigc::slot<void(int)> slot = sigc::mem_fun(handler, &Handler::handle);
+    report(" mem_fun: ", counter.count());
+  }
+}
+
+void
+test_connect()
+{
+  Handler handler1;
+  Handler handler2;
+  sigc::signal<void(int)> signal;
+  sigc::slot<void(int)> slot = sigc::ptr_fun(&free_handler);
+
+  AllocationCounter counter;
+  signal.connect(slot);
+  report("first: ", counter.count());
+
+  counter.reset();
+  signal.connect(slot);
+  report(" slot: ", counter.count());
+
+  counter.reset();
+  signal.connect(sigc::ptr_fun(&free_handler));
+  report(" ptr_fun: ", counter.count());
+
+  counter.reset();
+  signal.connect(sigc::ptr_fun<&free_handler>());
+  report(" static ptr_fun: ", counter.count());
+
+  counter.reset();
+  signal.connect(sigc::mem_fun(handler1, &Handler::handle));
+  report(" mem_fun: ", counter.count());
+
+  counter.reset();
+  signal.connect(sigc::mem_fun(handler2, &Handler::handle));
+  report(" mem_fun again: ", counter.count());
+}
+
+void
+test_connection_copy()
+{
+  sigc::signal<void(int)> signal;
+  const auto connection = signal.connect(sigc::ptr_fun(&free_handler));
+
+  AllocationCounter counter;
+  {
+    sigc::connection copy(connection);
+    report("copy: ", counter.count());
+  }
+
+  sigc::connection assigned;
+  counter.reset();
+  assigned = connection;
+  report(" assign: ", counter.count());
+}
+
+void
+test_emit()
+{
+  std::vector<std::unique_ptr<Handler>> handlers;
+  sigc::signal<void(int)> signal;
+  signal.emit(0); // No signal_impl yet.
+
+  for (const int n : { 0, 1, 10, 100 })
+  {
+    while (handlers.size() < static_cast<std::size_t>(n))
+    {
+      handlers.emplace_back(new Handler);
+      signal.connect(sigc::mem_fun(*handlers.back(), &Handler::handle));
+    }
+
+    AllocationCounter counter;
+    signal.emit(1);
+    const auto allocations = counter.count();
+    result_stream << n << ": " << allocations << " ";
+  }
+
+  {
+    // Nothing to call, so no temporary slot.
+    signal.block();
+    AllocationCounter counter;
+    signal.emit(1);
+    const auto allocations = counter.count();
+    result_stream << "blocked: " << allocations << " ";
+    signal.unblock();
+  }
+
+  sigc::signal<void(int)> empty;
+  AllocationCounter counter;
+  empty.emit(1);
+  report("no impl: ", counter.count());
+}
+
+void
+test_disconnect()
+{
+  Handler handler;
+  sigc::signal<void(int)> signal;
+  auto connection1 = signal.connect(sigc::mem_fun(handler, &Handler::handle));
+  auto connection2 = signal.connect(sigc::ptr_fun(&free_handler));
+
+  AllocationCounter counter;
+  connection1.disconnect();
+  connection2.disconnect();
+  report("disconnect: ", counter.count());
+
+  // Disconnect during emission, which defers the removal until sweep().
+  sigc::connection connection3;
+  connection3 = signal.connect([&connection3](int) { connection3.disconnect(); });
+  counter.reset();
+  signal.emit(1);
+  report(" during emission: ", counter.count());
+}
+
+void
+test_trackable_destruction()
+{
+  sigc::signal<void(int)> signal;
+  auto handler = new Handler;
+  signal.connect(sigc::mem_fun(*handler, &Handler::handle));
+  signal.connect(sigc::mem_fun(*handler, &Handler::handle));
+
+  AllocationCounter counter;
+  delete handler;
+  report("trackable: ", counter.count());
+
+  counter.reset();
+  signal.emit(1);
+  report(" emit: ", counter.count());
+  result_stream << " size: " << signal.size();
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  // typed_slot_rep and functor. With mem_fun(), a node in the trackable's callback list.
+  // Stateless functors share a static slot_rep.
+  test_slot_construction();
+  util->check_result(
+    result_stream, "ptr_fun: 2 static ptr_fun: 0 lambda and copy: 0 mem_fun: 3");
+
+  // A copy of the slot (2), the node in the signal's slot list, the slot's
+  // self_and_iter, and the slot_rep's callback list and its node.
+  // The first connection also allocates the signal_impl.
+  // A temporary mem_fun() slot also allocates a callback list and a node in the
+  // trackable, and a node for the slot copy.
+  // The copy of a stateless functor's slot_rep is a single allocation.
+  test_connect();
+  util->check_result(result_stream,
+    "first: 7 slot: 6 ptr_fun: 6 static ptr_fun: 5 mem_fun: 8 mem_fun again: 8");
+
+  // A node in the slot_rep's callback list.
+  test_connection_copy();
+  util->check_result(result_stream, "copy: 1 assign: 1");
+
+  // The temporary slot in the signal's slot list, independent of the number of slots,
+  // unless all slots are blocked.
+  test_emit();
+  util->check_result(result_stream, "0: 0 1: 1 10: 1 100: 1 blocked: 0 no impl: 0");
+
+  // The temporary slot of the emission.
+  test_disconnect();
+  util->check_result(result_stream, "disconnect: 0 during emission: 1");
+
+  // A weak_raw_ptr to each invalidated slot_rep.
+  test_trackable_destruction();
+  util->check_result(result_stream, "trackable: 2 emit: 0 size: 0");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
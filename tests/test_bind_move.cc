@@ -0,0 +1,155 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/adaptors/bind.h>
+#include <sigc++/functors/ptr_fun.h>
+#include <sigc++/functors/slot.h>
+#include <sigc++/signal.h>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+std::ostringstream result_stream;
+
+// Counts its copies.
+struct payload
+{
+  payload() = default;
+  payload(const payload& src) : data(src.data) { ++copies; }
+  payload(payload&& src) noexcept : data(std::move(src.data)) {}
+  payload& operator=(const payload&) = delete;
+  payload& operator=(payload&&) = delete;
+
+  std::string data = "payload";
+
+  static int copies;
+};
+
+int payload::copies = 0;
+
+void
+report_copies()
+{
+  result_stream << "copies: " << payload::copies << " ";
+  payload::copies = 0;
+}
+
+void
+show(int i, const payload& p)
+{
+  result_stream << "show(" << i << ", " << p.data << ") ";
+}
+
+void
+show_ptr(int i, const std::unique_ptr<int>& p)
+{
+  result_stream << "show_ptr(" << i << ", " << *p << ") ";
+}
+
+void
+show_shared(const std::shared_ptr<int>& p)
+{
+  result_stream << "show_shared(" << *p << ") ";
+}
+
+void
+test_copies()
+{
+  payload p;
+  auto bound_copy = sigc::bind(&show, p);
+  report_copies();
+  bound_copy(1);
+
+  auto bound_temporary = sigc::bind(&show, payload());
+  report_copies();
+  bound_temporary(2);
+
+  // The slot that the signal owns is the only construction.
+  sigc::signal<void(int)> sig;
+  sig.connect(sigc::bind(&show, payload()));
+  report_copies();
+  sig.emit(3);
+}
+
+void
+test_move_only()
+{
+  auto bound = sigc::bind(&show_ptr, std::make_unique<int>(42));
+  bound(1);
+
+  sigc::slot<void(int)> slot = std::move(bound);
+  slot(2);
+
+  // A slot whose functor can't be copied can only be moved.
+  try
+  {
+    sigc::slot<void(int)> copy = slot;
+    result_stream << "copied ";
+  }
+  catch (const std::logic_error&)
+  {
+    result_stream << "not copied ";
+  }
+
+  // Connecting an lvalue copies the slot.
+  sigc::signal<void(int)> sig;
+  try
+  {
+    sig.connect(slot);
+  }
+  catch (const std::logic_error&)
+  {
+    result_stream << "not connected ";
+  }
+  result_stream << sig.size() << " ";
+  sig.emit(3);
+
+  sig.connect(std::move(slot));
+  sig.connect(sigc::bind(&show_ptr, std::make_unique<int>(43)));
+  sig.emit(4);
+
+}
+
+void
+test_shared_ptr()
+{
+  auto p = std::make_shared<int>(7);
+  {
+    sigc::signal<void()> sig;
+    sig.connect(sigc::bind(&show_shared, p));
+    result_stream << p.use_count() << " ";
+    sig.emit();
+  }
+  result_stream << p.use_count();
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_copies();
+  util->check_result(result_stream,
+    "copies: 1 show(1, payload) copies: 0 show(2, payload) copies: 0 show(3, payload) ");
+
+  test_move_only();
+  util->check_result(result_stream,
+    "show_ptr(1, 42) show_ptr(2, 42) not copied not connected 0 "
+    "show_ptr(4, 42) show_ptr(4, 43) ");
+
+  test_shared_ptr();
+  util->check_result(result_stream, "2 show_shared(7) 1");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/trackable.h>
+#include <sigc++/signal.h>
+#include <sigc++/functors/mem_fun.h>
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+std::ostringstream result_stream;
+
+class A : public sigc::trackable
+{
+public:
+  void foo(int i) { result_stream << "A::foo(" << i << ") "; }
+};
+
+void
+bar(int i)
+{
+  result_stream << "bar(" << i << ") ";
+}
+
+struct sum_accumulator
+{
+  using result_type = int;
+
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+void
+test_block_connections()
+{
+  sigc::signal<void(int)> sig;
+  result_stream << sig.blocked() << " ";
+
+  auto connection1 = sig.connect(sigc::ptr_fun(&bar));
+  auto connection2 = sig.connect(sigc::ptr_fun(&bar));
+  result_stream << sig.blocked() << " ";
+
+  connection1.block();
+  result_stream << sig.blocked() << " ";
+  connection1.block(); // Already blocked.
+  connection2.block();
+  result_stream << sig.blocked() << " ";
+  sig.emit(1);
+
+  connection1.unblock();
+  result_stream << sig.blocked() << " ";
+  sig.emit(2);
+
+  // Disconnecting the unblocked slot leaves only blocked slots.
+  connection1.disconnect();
+  result_stream << sig.blocked() << " ";
+
+  connection2.disconnect();
+  result_stream << sig.blocked();
+}
+
+void
+test_block_signal()
+{
+  sigc::signal<void(int)> sig;
+  sig.connect(sigc::ptr_fun(&bar));
+  auto connection = sig.connect(sigc::ptr_fun(&bar));
+
+  sig.block();
+  result_stream << sig.blocked() << " ";
+  sig.emit(3);
+
+  connection.unblock();
+  result_stream << sig.blocked() << " ";
+  sig.emit(4);
+
+  sig.unblock();
+  result_stream << sig.blocked() << " ";
+
+  // A slot that is blocked before it is connected.
+  sigc::slot<void(int)> slot = sigc::ptr_fun(&bar);
+  slot.block();
+  sig.clear();
+  sig.connect(slot);
+  result_stream << sig.blocked();
+}
+
+void
+test_trackable()
+{
+  sigc::signal<void(int)> sig;
+  sig.connect(sigc::ptr_fun(&bar)).block();
+  {
+    A a;
+    sig.connect(sigc::mem_fun(a, &A::foo));
+    result_stream << sig.blocked() << " ";
+  }
+  // The slot of the deleted trackable was the only unblocked one.
+  result_stream << sig.blocked() << " ";
+  sig.emit(5);
+}
+
+void
+test_during_emission()
+{
+  sigc::signal<void(int)> sig;
+  sigc::connection connection1;
+  sigc::connection connection2;
+
+  // The first slot blocks itself and disconnects the second slot.
+  connection1 = sig.connect([&](int i) {
+    result_stream << "first(" << i << ") ";
+    connection1.block();
+    connection2.disconnect();
+  });
+  connection2 = sig.connect(sigc::ptr_fun(&bar));
+  connection2.block();
+
+  sig.emit(6);
+  result_stream << sig.size() << " " << sig.blocked() << " ";
+  sig.emit(7);
+
+  connection1.unblock();
+  sig.emit(8);
+  result_stream << sig.blocked();
+}
+
+void
+test_accumulated()
+{
+  sigc::signal<int(int)>::accumulated<sum_accumulator> sig;
+  auto connection = sig.connect([](int i) { return i * 2; });
+  result_stream << sig.emit(5) << " ";
+  connection.block();
+  result_stream << sig.emit(5);
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_block_connections();
+  util->check_result(result_stream, "1 0 0 1 0 bar(2) 1 1");
+
+  test_block_signal();
+  util->check_result(result_stream, "1 0 bar(4) 0 1");
+
+  test_trackable();
+  util->check_result(result_stream, "0 1 ");
+
+  test_during_emission();
+  util->check_result(result_stream, "first(6) 1 1 first(8) 1");
+
+  test_accumulated();
+  util->check_result(result_stream, "10 0");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
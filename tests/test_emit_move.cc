@@ -0,0 +1,251 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/sigc++.h>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::ostringstream result_stream;
+
+// Counts its copies and moves.
+struct payload
+{
+  payload() = default;
+  payload(const payload& src) : data(src.data) { ++copies; }
+  payload(payload&& src) noexcept : data(std::move(src.data)) { ++moves; }
+  payload& operator=(const payload&) = delete;
+  payload& operator=(payload&&) = delete;
+
+  std::string data = "payload";
+
+  static int copies;
+  static int moves;
+};
+
+int payload::copies = 0;
+int payload::moves = 0;
+
+void
+reset_counts()
+{
+  payload::copies = 0;
+  payload::moves = 0;
+}
+
+void
+report_counts()
+{
+  result_stream << "copies: " << payload::copies << " moves: " << payload::moves;
+  reset_counts();
+}
+
+void
+consume(payload p)
+{
+  result_stream << "consume(" << p.data << ") ";
+}
+
+void
+consume_with(payload p, int, const std::string& s)
+{
+  result_stream << "consume_with(" << p.data << ", " << s << ") ";
+}
+
+struct consumer : public sigc::trackable
+{
+  void store(payload p) { stored.push_back(std::move(p.data)); }
+  int size(payload p) { return static_cast<int>(p.data.size()); }
+
+  std::vector<std::string> stored;
+};
+
+void
+test_emit()
+{
+  consumer c;
+  sigc::signal<void(payload)> sig;
+  sig.connect([](const payload& p) { result_stream << "observe(" << p.data << ") "; });
+  sig.connect(sigc::ptr_fun(&consume));
+  sig.connect(sigc::mem_fun(c, &consumer::store));
+
+  // Each slot that takes the payload by value copies it.
+  payload p;
+  reset_counts();
+  sig.emit(p);
+  report_counts();
+  result_stream << " ";
+
+  // The last slot moves it.
+  sig.emit_move(payload());
+  report_counts();
+  result_stream << " " << c.stored.size() << " " << c.stored.back();
+}
+
+void
+test_last_unblocked()
+{
+  sigc::signal<void(payload)> sig;
+  sig.connect(sigc::ptr_fun(&consume));
+  auto last = sig.connect(sigc::ptr_fun(&consume));
+  last.block();
+
+  reset_counts();
+  sig.emit_move(payload());
+  report_counts();
+}
+
+void
+test_adaptors()
+{
+  consumer c;
+  sigc::signal<void(payload, int)> sig;
+
+  // Each adaptor passes the rvalue on.
+  sig.connect(sigc::hide<1>(sigc::ptr_fun(&consume)));
+  reset_counts();
+  sig.emit_move(payload(), 1);
+  result_stream << "hide ";
+  report_counts();
+  result_stream << " ";
+
+  sig.clear();
+  sig.connect(sigc::bind(sigc::ptr_fun(&consume_with), std::string("bound")));
+  reset_counts();
+  sig.emit_move(payload(), 1);
+  result_stream << "bind ";
+  report_counts();
+  result_stream << " ";
+
+  sig.clear();
+  sig.connect(sigc::track_obj([](payload p, int) { result_stream << p.data << " "; }, c));
+  reset_counts();
+  sig.emit_move(payload(), 1);
+  result_stream << "track_obj ";
+  report_counts();
+  result_stream << " ";
+
+  sig.clear();
+  sig.connect(sigc::exception_catch(
+    [](payload p, int) { result_stream << p.data << " "; }, []() {}));
+  reset_counts();
+  sig.emit_move(payload(), 1);
+  result_stream << "exception_catch ";
+  report_counts();
+  result_stream << " ";
+
+  sig.clear();
+  sig.connect(sigc::retype_return<void>(sigc::hide<1>(sigc::mem_fun(c, &consumer::size))));
+  reset_counts();
+  sig.emit_move(payload(), 1);
+  result_stream << "retype_return ";
+  report_counts();
+}
+
+void
+test_return_value()
+{
+  consumer c;
+  sigc::signal<int(payload)> sig;
+  sig.connect(sigc::mem_fun(c, &consumer::size));
+  sig.connect([](payload p) { return static_cast<int>(p.data.size()) * 2; });
+
+  reset_counts();
+  result_stream << sig.emit_move(payload()) << " ";
+  report_counts();
+}
+
+void
+test_slot()
+{
+  sigc::slot<void(payload)> slot = sigc::ptr_fun(&consume);
+  reset_counts();
+  slot(payload());
+  report_counts();
+}
+
+struct sum_accumulator
+{
+  using result_type = int;
+
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+void
+test_accumulated()
+{
+  consumer c;
+  sigc::signal<int(payload)>::accumulated<sum_accumulator> sig;
+  sig.connect(sigc::mem_fun(c, &consumer::size));
+  sig.connect(sigc::mem_fun(c, &consumer::size));
+
+  // Accumulated signals don't move the arguments.
+  reset_counts();
+  result_stream << sig.emit_move(payload()) << " ";
+  report_counts();
+}
+
+void
+test_move_only()
+{
+  std::unique_ptr<int> taken;
+  sigc::signal<void(std::unique_ptr<int>)> sig;
+  sig.connect([](const std::unique_ptr<int>& p) { result_stream << "observe(" << *p << ") "; });
+  sig.connect([&taken](std::unique_ptr<int> p) { taken = std::move(p); });
+
+  sig.emit(std::make_unique<int>(42));
+  result_stream << *taken;
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_emit();
+  util->check_result(result_stream,
+    "observe(payload) consume(payload) copies: 2 moves: 0 "
+    "observe(payload) consume(payload) copies: 1 moves: 1 2 payload");
+
+  test_last_unblocked();
+  util->check_result(result_stream, "consume(payload) copies: 0 moves: 1");
+
+  test_adaptors();
+  util->check_result(result_stream,
+    "consume(payload) hide copies: 0 moves: 1 "
+    "consume_with(payload, bound) bind copies: 0 moves: 1 "
+    "payload track_obj copies: 0 moves: 1 "
+    "payload exception_catch copies: 0 moves: 1 "
+    "retype_return copies: 0 moves: 1");
+
+  test_return_value();
+  util->check_result(result_stream, "14 copies: 1 moves: 1");
+
+  test_slot();
+  util->check_result(result_stream, "consume(payload) copies: 0 moves: 1");
+
+  test_accumulated();
+  util->check_result(result_stream, "14 copies: 2 moves: 0");
+
+  test_move_only();
+  util->check_result(result_stream, "observe(42) 42");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -4,6 +4,7 @@
 
 #include "testutilities.h"
 #include <sigc++/adaptors/exception_catch.h>
+#include <sigc++/functors/slot.h>
 
 namespace
 {
@@ -95,5 +96,10 @@ main(int argc, char* argv[])
   sigc::exception_catch(g_void(), my_catch_void())(); // void test
   util->check_result(result_stream, "g_void() caught out of range ");
 
+  // The slot passes the int by value.
+  sigc::slot<int(int)> sl = sigc::exception_catch(f(), my_catch());
+  result_stream << sl(3);
+  util->check_result(result_stream, "f(int 3) caught out of range 1");
+
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
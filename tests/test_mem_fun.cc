@@ -167,6 +167,44 @@ void test_auto_disconnect()
   util->check_result(result_stream, "");
 }
 
+void test_bound_method()
+{
+  test t;
+  auto functor = sigc::mem_fun<&test::foo>(t);
+  static_assert(sizeof(functor) == sizeof(&t), "mem_fun<&T::method>() should store only a pointer");
+  functor(11);
+  util->check_result(result_stream, "test::foo(short 11)");
+
+  const test& ct = t;
+  sigc::mem_fun<&test::foo_const>(ct)(11);
+  util->check_result(result_stream, "test::foo_const(int 11)");
+
+  sigc::mem_fun<&test::foo_volatile>(t)(11);
+  util->check_result(result_stream, "test::foo_volatile(float 11)");
+
+  sigc::mem_fun<static_cast<double (test::*)(int, int)>(&test::foo_overloaded)>(t)(11, 12);
+  util->check_result(result_stream, "test::foo_overloaded(int 11, int 12)");
+
+  sigc::slot<void()> slot = sigc::bind(sigc::mem_fun<&test::foo_const>(t), 13);
+  slot();
+  util->check_result(result_stream, "test::foo_const(int 13)");
+}
+
+void test_bound_method_auto_disconnect()
+{
+  sigc::slot<void()> slot_of_member_method;
+  {
+    TestAutoDisconnect t;
+    slot_of_member_method = sigc::mem_fun<&TestAutoDisconnect::foo>(t);
+
+    slot_of_member_method();
+    util->check_result(result_stream, "TestAutoDisconnect::foo() called.");
+  }
+
+  slot_of_member_method();
+  util->check_result(result_stream, "");
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -190,5 +228,8 @@ main(int argc, char* argv[])
 
   test_auto_disconnect();
 
+  test_bound_method();
+  test_bound_method_auto_disconnect();
+
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
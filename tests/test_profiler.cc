@@ -0,0 +1,139 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/profiler.h>
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <sigc++/functors/mem_fun.h>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+std::ostringstream result_stream;
+
+class Slow : public sigc::trackable
+{
+public:
+  int handler(int i)
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    return i;
+  }
+};
+
+class Fast : public sigc::trackable
+{
+public:
+  int handler(int i) { return i + 1; }
+};
+
+struct sum_accumulator
+{
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+void
+test_top_slots()
+{
+  Slow slow;
+  Fast fast;
+  sigc::signal<int(int)> signal_test;
+  signal_test.connect(sigc::mem_fun(fast, &Fast::handler));
+  signal_test.connect(sigc::mem_fun(slow, &Slow::handler));
+
+  sigc::reset_slot_profiles();
+  sigc::set_slot_profiling(1.0);
+  for (int i = 0; i < 10; ++i)
+    signal_test.emit(i);
+  sigc::set_slot_profiling(0.0);
+  signal_test.emit(10); // Not sampled.
+
+  const auto profiles = sigc::slot_profiles();
+  result_stream << profiles.size() << " ";
+  if (profiles.size() == 2)
+  {
+    const auto& top = profiles[0];
+    result_stream << (top.functor_type.find("Slow") != std::string::npos) << " "
+                  << top.samples << " " << profiles[1].samples << " "
+                  << (top.mean_ns() >= 200000.0) << " "
+                  << (top.percentile_ns(50) >= 200000) << " "
+                  << (top.max_ns >= top.percentile_ns(99.9));
+  }
+
+  // Only the slowest slot.
+  result_stream << " " << sigc::slot_profiles(1).size();
+}
+
+void
+test_sampling_fraction()
+{
+  Fast fast;
+  sigc::signal<int(int)>::accumulated<sum_accumulator> signal_test;
+  signal_test.connect(sigc::mem_fun(fast, &Fast::handler));
+
+  sigc::reset_slot_profiles();
+  sigc::set_slot_profiling(0.25);
+  for (int i = 0; i < 100; ++i)
+    signal_test.emit(i);
+  sigc::set_slot_profiling(0.0);
+
+  const auto profiles = sigc::slot_profiles();
+  result_stream << profiles.size() << " " << (profiles.empty() ? 0 : profiles[0].samples);
+}
+
+void
+test_destroyed_slots()
+{
+  Fast fast;
+  sigc::reset_slot_profiles();
+  sigc::set_slot_profiling(1.0);
+  for (int i = 0; i < 3; ++i)
+  {
+    // Each new slot is likely to be allocated where the previous one was.
+    sigc::slot<int(int)> slot_test = sigc::mem_fun(fast, &Fast::handler);
+    slot_test(i);
+    const auto profiles = sigc::slot_profiles();
+    result_stream << profiles.size() << " " << (profiles.empty() ? 0 : profiles[0].samples) << " ";
+  }
+  sigc::set_slot_profiling(0.0);
+
+  // The profiles of the destroyed slots have been discarded.
+  result_stream << sigc::slot_profiles().size();
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_top_slots();
+  util->check_result(result_stream, "2 1 10 10 1 1 1 1");
+
+  test_sampling_fraction();
+  util->check_result(result_stream, "1 25");
+
+  test_destroyed_slots();
+  util->check_result(result_stream, "1 1 1 1 1 1 0");
+
+  sigc::reset_slot_profiles();
+  result_stream << sigc::slot_profiles().size();
+  util->check_result(result_stream, "0");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
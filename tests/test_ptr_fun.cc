@@ -97,5 +97,15 @@ main(int argc, char* argv[])
   sigc::ptr_fun (&test::foo)();
   util->check_result(result_stream, "test::foo()");
 
+  // The function as a template argument.
+  sigc::ptr_fun<&foo>()(6);
+  util->check_result(result_stream, "foo(int 6)");
+
+  sigc::ptr_fun<&test::foo>()();
+  util->check_result(result_stream, "test::foo()");
+
+  result_stream << sigc::ptr_fun<&bar>()(7, 8);
+  util->check_result(result_stream, "bar(int 7, int 8)1");
+
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,246 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/recorder.h>
+#include <sigc++/signal.h>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace
+{
+std::ostringstream result_stream;
+
+const char log_filename[] = "test_recorder.sigclog";
+
+struct Point
+{
+  int x;
+  int y;
+};
+
+void
+on_moved(int id, double distance)
+{
+  result_stream << "moved(" << id << "," << distance << ") ";
+}
+
+int
+on_point(const Point& p)
+{
+  result_stream << "point(" << p.x << "," << p.y << ") ";
+  return p.x + p.y;
+}
+
+void
+on_text(const std::string& text)
+{
+  result_stream << "text(" << text << ") ";
+}
+
+void
+test_record()
+{
+  sigc::signal<void(int, double)> moved;
+  sigc::signal<int(const Point&)> point;
+  sigc::signal<void(std::string)> text; // Not recordable.
+  sigc::signal<void(int, double)> unrecorded;
+  moved.connect(sigc::ptr_fun(&on_moved));
+  text.connect(sigc::ptr_fun(&on_text));
+
+  sigc::emission_recorder recorder(log_filename);
+  recorder.add(moved, 1);
+  recorder.add(point, 2);
+  {
+    sigc::signal<void(int, double)> temporary;
+    recorder.add(temporary, 3);
+    temporary.emit(0, 0.0);
+  }
+
+  moved.emit(1, 2.5);
+  point.emit({ 3, 4 });
+  text.emit("not recorded");
+  unrecorded.emit(0, 0.0);
+  moved.emit(5, 0.5);
+
+  recorder.remove(moved);
+  moved.emit(6, 1.0);
+
+  result_stream << recorder.emissions();
+}
+
+void
+test_play()
+{
+  sigc::signal<void(int, double)> moved;
+  sigc::signal<int(const Point&)> point;
+  moved.connect(sigc::ptr_fun(&on_moved));
+  point.connect(sigc::ptr_fun(&on_point));
+
+  sigc::emission_player player(log_filename);
+  player.bind(1, moved);
+  result_stream << player.play() << " ";
+
+  player.bind(2, point);
+  result_stream << player.play();
+}
+
+void
+test_bind_errors()
+{
+  sigc::signal<void(int, double)> moved;
+  sigc::signal<void(const int&, double)> moved_by_reference;
+  sigc::signal<int(const Point&)> point;
+  sigc::emission_player player(log_filename);
+
+  try
+  {
+    player.bind(4, moved);
+  }
+  catch (const std::invalid_argument&)
+  {
+    result_stream << "unknown channel ";
+  }
+
+  try
+  {
+    player.bind(1, point);
+  }
+  catch (const std::invalid_argument&)
+  {
+    result_stream << "wrong types ";
+  }
+
+  // References and cv-qualifiers don't matter.
+  player.bind(1, moved_by_reference);
+  result_stream << player.play();
+}
+
+void
+test_no_arguments()
+{
+  sigc::signal<void()> clicked;
+  clicked.connect([]() { result_stream << "clicked "; });
+  {
+    sigc::emission_recorder recorder(log_filename);
+    recorder.add(clicked, 1);
+    clicked.emit();
+    clicked.emit();
+  }
+
+  sigc::emission_player player(log_filename);
+  player.bind(1, clicked);
+  result_stream << player.play();
+}
+
+// Writes the first bytes of the log to another file.
+void
+copy_log(const char* filename, long size)
+{
+  std::FILE* in = std::fopen(log_filename, "rb");
+  std::FILE* out = std::fopen(filename, "wb");
+  for (int c; size-- > 0 && (c = std::fgetc(in)) != EOF;)
+    std::fputc(c, out);
+  std::fclose(in);
+  std::fclose(out);
+}
+
+long
+log_size()
+{
+  std::FILE* file = std::fopen(log_filename, "rb");
+  std::fseek(file, 0, SEEK_END);
+  const long size = std::ftell(file);
+  std::fclose(file);
+  return size;
+}
+
+void
+test_invalid_logs()
+{
+  const char invalid_filename[] = "test_recorder_invalid.sigclog";
+  const long size = log_size();
+
+  // A truncated record, a truncated header, and no log at all.
+  for (const long truncated_size : { size - 4, 10l })
+  {
+    copy_log(invalid_filename, truncated_size);
+    try
+    {
+      sigc::emission_player player(invalid_filename);
+      result_stream << "accepted ";
+    }
+    catch (const std::runtime_error&)
+    {
+      result_stream << "invalid ";
+    }
+  }
+
+  std::remove(invalid_filename);
+  try
+  {
+    sigc::emission_player player(invalid_filename);
+    result_stream << "accepted";
+  }
+  catch (const std::system_error&)
+  {
+    result_stream << "missing";
+  }
+}
+
+void
+test_crashed_log()
+{
+  // A recorder that crashed leaves the zero-filled rest of its file behind.
+  const char crashed_filename[] = "test_recorder_crashed.sigclog";
+  copy_log(crashed_filename, log_size());
+  std::FILE* file = std::fopen(crashed_filename, "ab");
+  for (int i = 0; i < 4096; ++i)
+    std::fputc(0, file);
+  std::fclose(file);
+
+  sigc::signal<void()> clicked;
+  sigc::emission_player player(crashed_filename);
+  player.bind(1, clicked);
+  result_stream << player.play();
+  std::remove(crashed_filename);
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_record();
+  util->check_result(
+    result_stream, "moved(1,2.5) text(not recorded) moved(5,0.5) moved(6,1) 4");
+
+  test_play();
+  util->check_result(result_stream,
+    "moved(1,2.5) moved(5,0.5) 2 moved(1,2.5) point(3,4) moved(5,0.5) 3");
+
+  test_bind_errors();
+  util->check_result(result_stream, "unknown channel wrong types 2");
+
+  test_no_arguments();
+  util->check_result(result_stream, "clicked clicked clicked clicked 2");
+
+  test_invalid_logs();
+  util->check_result(result_stream, "invalid invalid missing");
+
+  test_crashed_log();
+  util->check_result(result_stream, "2");
+
+  std::remove(log_filename);
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
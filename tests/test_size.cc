@@ -1,78 +1,180 @@
-/* Copyright 2002 - 2016, The libsigc++ Development Team
+/* Copyright 2002 - 2026, The libsigc++ Development Team
  *  Assigned to public domain.  Use as you wish without restriction.
  */
 
 #include "testutilities.h"
 #include <sigc++/sigc++.h>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
+#include <string>
 
-// The correct result of this test may be implementation-dependent.
-// No attempt is made to decide if the result is correct.
-// The test will succeed, unless it's started with erroneous command arguments.
-// "./test_size --verbose" shows the sizes.
+// Compares the sizes of libsigc++ objects, and the heap bytes of slots,
+// connections and signals, with budgets. The test fails if a size exceeds its
+// budget. When a change makes something smaller, lower its budget.
+// "./test_size --verbose" shows the sizes and the budgets.
+//
+// The budgets are in units of sizeof(void*). On 64-bit systems with libstdc++
+// they are the current sizes, rounded up to whole units. Other platforms get
+// some slack, because their standard library types may be larger.
 
 namespace
 {
-struct A
+std::ostringstream result_stream;
+
+#if defined(_MSC_VER) && defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+// Checked iterators make the standard containers larger. Don't check.
+#define SIGC_TEST_SIZE_UNCHECKED 1
+const std::size_t slack_words = 0;
+#elif UINTPTR_MAX == 0xffffffffffffffffu && !defined(_MSC_VER) && defined(__GLIBCXX__)
+// The budgets have been measured with libstdc++ on 64-bit platforms.
+const std::size_t slack_words = 0;
+#else
+const std::size_t slack_words = 2;
+#endif
+
+const std::size_t word = sizeof(void*);
+
+struct A : public sigc::trackable
 {
   void foo() {}
+  void bar(int) {}
 };
-} // end anonymous namespace
 
-int
-main(int argc, char* argv[])
+void
+free_function()
 {
-  auto util = TestUtilities::get_instance();
+}
 
-  if (!util->check_command_args(argc, argv))
-    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+// The heap bytes of a slot_rep for T_functor: the typed_slot_rep and its functor,
+// or the stateless_slot_rep of a connected slot.
+template <typename T_functor>
+std::size_t
+slot_rep_bytes(const T_functor&)
+{
+  if (sigc::internal::is_stateless_functor<T_functor>::value)
+    return sizeof(sigc::internal::stateless_slot_rep<T_functor>);
+  return sizeof(sigc::internal::typed_slot_rep<T_functor>) +
+         sizeof(typename sigc::adaptor_trait<T_functor>::adaptor_type);
+}
+
+void
+check(const std::string& what, std::int64_t size, std::size_t budget_words)
+{
+  const auto budget = static_cast<std::int64_t>((budget_words + slack_words) * word);
+  if (TestUtilities::get_instance()->get_verbose())
+    std::cout << "  " << std::left << std::setw(40) << what << std::right << std::setw(6)
+              << size << " (budget " << budget << ")" << std::endl;
+
+  if (result_stream.tellp() > 0)
+    result_stream << " ";
+  result_stream << what;
+#ifndef SIGC_TEST_SIZE_UNCHECKED
+  if (size > budget)
+    result_stream << "(" << size << " > " << budget << ")";
+#endif
+}
+
+void
+test_public_classes()
+{
+  check("trackable", sizeof(sigc::trackable), 1);
+  check("slot<void()>", sizeof(sigc::slot<void()>), 2);
+  check("signal<void()>", sizeof(sigc::signal<void()>), 2);
+  check("connection", sizeof(sigc::connection), 1);
+}
 
-  if (util->get_verbose())
+void
+test_internal_classes()
+{
+  check("trackable_callback", sizeof(sigc::internal::trackable_callback), 2);
+  check("trackable_callback_list", sizeof(sigc::internal::trackable_callback_list), 4);
+  check("slot_rep", sizeof(sigc::internal::slot_rep), 5);
+  check("signal_impl", sizeof(sigc::internal::signal_impl), 6);
+}
+
+void
+test_slot_reps()
+{
+  A a;
+  int i = 0;
+  check("slot_rep<mem_fun>", slot_rep_bytes(sigc::mem_fun(a, &A::foo)), 10);
+  check("slot_rep<ptr_fun>", slot_rep_bytes(sigc::ptr_fun(&free_function)), 7);
+  check("slot_rep<ptr_fun<&f>>", slot_rep_bytes(sigc::ptr_fun<&free_function>()), 6);
+  check("slot_rep<lambda>", slot_rep_bytes([]() {}), 6);
+  check("slot_rep<lambda(int*)>", slot_rep_bytes([&i]() { ++i; }), 7);
+  check("slot_rep<bind(mem_fun)>", slot_rep_bytes(sigc::bind(sigc::mem_fun(a, &A::bar), 1)), 12);
+  check("slot_rep<hide(bind(mem_fun))>",
+    slot_rep_bytes(sigc::hide(sigc::bind(sigc::mem_fun(a, &A::bar), 1))), 13);
+}
+
+void
+test_heap()
+{
+  A a;
+  sigc::signal<void()> signal;
   {
-    std::cout << "sizes of public classes:" << std::endl;
+    // Let a allocate its list of destroy notification callbacks.
+    sigc::slot<void()> slot = sigc::mem_fun(a, &A::foo);
+  }
 
-    //libsigc++ 2.10: 8
-    //libsigc++ 3.0: 8
-    std::cout << "  trackable:               " << sizeof(sigc::trackable) << std::endl;
+  AllocationCounter counter;
+  {
+    sigc::slot<void()> slot = sigc::mem_fun(a, &A::foo);
+    check("slot heap<mem_fun>", counter.live_bytes(), 14);
+  }
 
-    //libsigc++ 2.10: 16
-    //libsigc++ 3.0: 16
-    std::cout << "  slot<void()>:              " << sizeof(sigc::slot<void()>) << std::endl;
+  counter.reset();
+  {
+    sigc::slot<void()> slot = []() {};
+    check("slot heap<lambda>", counter.live_bytes(), 0);
+  }
 
-    //libsigc++ 2.10: 16
-    //libsigc++ 3.0: 16
-    std::cout << "  signal<void()>:            " << sizeof(sigc::signal<void()>) << std::endl;
+  counter.reset();
+  signal.connect(sigc::ptr_fun(&free_function));
+  const auto first_connection = counter.live_bytes();
 
-    //libsigc++ 2.10: 8
-    //libsigc++ 3.0: 8
-    std::cout << "  connection:              " << sizeof(sigc::connection) << std::endl;
+  counter.reset();
+  signal.connect(sigc::ptr_fun(&free_function));
+  check("connection heap<ptr_fun>", counter.live_bytes(), 17);
+  check("signal heap", first_connection - counter.live_bytes(), 8);
 
+  counter.reset();
+  signal.connect(sigc::ptr_fun<&free_function>());
+  check("connection heap<ptr_fun<&f>>", counter.live_bytes(), 16);
 
-    std::cout << std::endl << "sizes of internal classes:" << std::endl;
+  counter.reset();
+  signal.connect(sigc::mem_fun(a, &A::foo));
+  check("connection heap<mem_fun>", counter.live_bytes(), 24);
+}
 
-    //libsigc++ 2.10: 16
-    //libsigc++ 3.0: 16
-    std::cout << "  trackable_callback:      " << sizeof(sigc::internal::trackable_callback)
-              << std::endl;
+} // end anonymous namespace
 
-    //libsigc++ 2.10: 32
-    //libsigc++ 3.0: 32
-    std::cout << "  trackable_callback_list: " << sizeof(sigc::internal::trackable_callback_list)
-              << std::endl;
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
 
-    //libsigc++ 2.10: 48
-    //libsigc++ 3.0: 48
-    std::cout << "  slot_rep:                " << sizeof(sigc::internal::slot_rep) << std::endl;
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 
-    //libsigc++ 2.10: 72
-    //libsigc++ 3.0: 64
-    std::cout << "  typed_slot_rep<mem_functor<void,A> >: "
-              << sizeof(sigc::internal::typed_slot_rep<sigc::mem_functor<void (A::*)()>>)
-              << std::endl;
+  test_public_classes();
+  util->check_result(result_stream, "trackable slot<void()> signal<void()> connection");
+
+  test_internal_classes();
+  util->check_result(
+    result_stream, "trackable_callback trackable_callback_list slot_rep signal_impl");
+
+  test_slot_reps();
+  util->check_result(result_stream,
+    "slot_rep<mem_fun> slot_rep<ptr_fun> slot_rep<ptr_fun<&f>> slot_rep<lambda> "
+    "slot_rep<lambda(int*)> "
+    "slot_rep<bind(mem_fun)> slot_rep<hide(bind(mem_fun))>");
+
+  test_heap();
+  util->check_result(result_stream,
+    "slot heap<mem_fun> slot heap<lambda> connection heap<ptr_fun> signal heap "
+    "connection heap<ptr_fun<&f>> connection heap<mem_fun>");
 
-    //libsigc++ 2.10: 32
-    //libsigc++ 3.0: 32
-    std::cout << "  signal_impl:             " << sizeof(sigc::internal::signal_impl) << std::endl;
-  }
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
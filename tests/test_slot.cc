@@ -4,6 +4,8 @@
 
 #include "testutilities.h"
 #include <sigc++/functors/slot.h>
+#include <string>
+#include <type_traits>
 
 // The Tru64 compiler seems to need this to avoid an unresolved symbol
 // See bug #161503
@@ -14,6 +16,15 @@ namespace
 TestUtilities* util = nullptr;
 std::ostringstream result_stream;
 
+// Small trivially copyable arguments are passed by value, others by reference.
+static_assert(std::is_same<sigc::type_trait_take_t<int>, int>::value, "");
+static_assert(std::is_same<sigc::type_trait_take_t<double*>, double*>::value, "");
+static_assert(std::is_same<sigc::type_trait_take_t<std::string>, const std::string&>::value, "");
+static_assert(std::is_same<sigc::type_trait_take_t<int&>, int&>::value, "");
+static_assert(std::is_same<sigc::type_trait_take_t<const int&>, const int&>::value, "");
+static_assert(std::is_same<sigc::type_trait_pass_t<int>, int>::value, "");
+static_assert(std::is_same<sigc::type_trait_pass_t<std::string>, std::string&>::value, "");
+
 class foo
 {
 public:
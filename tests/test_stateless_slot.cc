@@ -0,0 +1,128 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/sigc++.h>
+#include <cstdlib>
+
+namespace
+{
+std::ostringstream result_stream;
+
+void
+foo(int i)
+{
+  result_stream << "foo(" << i << ") ";
+}
+
+int
+twice(int i)
+{
+  return i * 2;
+}
+
+static_assert(sigc::internal::is_stateless_functor<decltype(sigc::ptr_fun<&foo>())>::value, "");
+static_assert(!sigc::internal::is_stateless_functor<decltype(sigc::ptr_fun(&foo))>::value, "");
+
+void
+test_slot()
+{
+  sigc::slot<void(int)> slot1 = sigc::ptr_fun<&foo>();
+  sigc::slot<void(int)> slot2 = slot1;
+  sigc::slot<void(int)> slot3 = [](int i) { result_stream << "lambda(" << i << ") "; };
+  slot1(1);
+  slot2(2);
+  slot3(3);
+
+  // Disconnecting a slot doesn't affect the slots that share its slot_rep.
+  slot1.disconnect();
+  result_stream << slot1.empty() << slot2.empty() << " ";
+  slot1(4);
+  slot2(5);
+
+  // Assign and move.
+  slot1 = slot3;
+  slot1(6);
+  sigc::slot<void(int)> slot4 = std::move(slot2);
+  result_stream << slot2.empty() << slot4.empty() << " ";
+  slot4(7);
+}
+
+void
+test_return_value()
+{
+  // The same functor type with different signatures.
+  sigc::slot<int(int)> slot1 = sigc::ptr_fun<&twice>();
+  sigc::slot<long(short)> slot2 = sigc::ptr_fun<&twice>();
+  result_stream << slot1(2) << " " << slot2(3);
+}
+
+void
+test_signal()
+{
+  sigc::signal<void(int)> signal;
+  sigc::slot<void(int)> slot = sigc::ptr_fun<&foo>();
+  auto connection1 = signal.connect(slot);
+  auto connection2 = signal.connect(slot);
+  auto connection3 = signal.connect([](int i) { result_stream << "lambda(" << i << ") "; });
+  signal.emit(1);
+
+  // The connected slots have their own slot_reps.
+  connection1.disconnect();
+  connection3.block();
+  signal.emit(2);
+  slot(3);
+  result_stream << signal.size() << " " << connection2.connected();
+}
+
+void
+test_connection_to_unconnected_slot()
+{
+  sigc::slot<void(int)> slot1 = sigc::ptr_fun<&foo>();
+  sigc::slot<void(int)> slot2 = slot1;
+  sigc::connection connection(slot1);
+  connection.disconnect();
+  result_stream << slot1.empty() << slot2.empty() << " ";
+  slot2(1);
+}
+
+void
+test_slot_in_slot()
+{
+  sigc::signal<void(int)> signal;
+  sigc::slot<void(int)> inner = sigc::ptr_fun<&foo>();
+  sigc::slot<void(int)> outer = sigc::hide(sigc::bind(inner, 2));
+  signal.connect(outer);
+  signal.emit(3);
+  inner(4);
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_slot();
+  util->check_result(
+    result_stream, "foo(1) foo(2) lambda(3) 10 foo(5) lambda(6) 10 foo(7) ");
+
+  test_return_value();
+  util->check_result(result_stream, "4 6");
+
+  test_signal();
+  util->check_result(result_stream, "foo(1) foo(1) lambda(1) foo(2) foo(3) 2 1");
+
+  test_connection_to_unconnected_slot();
+  util->check_result(result_stream, "10 foo(1) ");
+
+  test_slot_in_slot();
+  util->check_result(result_stream, "foo(2) foo(4) ");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
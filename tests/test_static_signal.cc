@@ -0,0 +1,187 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/sigc++.h>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+namespace
+{
+std::ostringstream result_stream;
+
+void
+foo(int i)
+{
+  result_stream << "foo(" << i << ") ";
+}
+
+int
+twice(int i)
+{
+  return i * 2;
+}
+
+struct A : public sigc::trackable
+{
+  int bar(int i)
+  {
+    result_stream << "A::bar(" << i << ") ";
+    return i + 1;
+  }
+
+  void baz(const std::string& s, int i) { result_stream << "A::baz(" << s << ", " << i << ") "; }
+};
+
+struct sum_accumulator
+{
+  using result_type = int;
+
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+// Stops the emission at the first functor that returns zero.
+struct interruptable_accumulator
+{
+  using result_type = bool;
+
+  template <typename T_iterator>
+  bool operator()(T_iterator first, T_iterator last) const
+  {
+    for (; first != last; ++first)
+      if (!*first)
+        return false;
+    return true;
+  }
+};
+
+// Counts the calls of void functors.
+struct count_accumulator
+{
+  using result_type = int;
+
+  template <typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int count = 0;
+    for (; first != last; ++first, ++count)
+      *first;
+    return count;
+  }
+};
+
+void
+test_emit()
+{
+  A a;
+  sigc::static_signal sig(
+    sigc::ptr_fun<&foo>(), sigc::mem_fun<&A::bar>(a), [](int i) { return i * 10; });
+  static_assert(sig.size() == 3, "");
+  result_stream << sig.emit(1) << " ";
+  result_stream << sig(2);
+}
+
+void
+test_adaptors()
+{
+  A a;
+  sigc::static_signal sig(sigc::bind(sigc::mem_fun(a, &A::baz), 1),
+    sigc::hide(sigc::bind(sigc::mem_fun<&A::baz>(a), "bound", 0)),
+    sigc::retype_return<void>(sigc::bind(sigc::hide<0>(sigc::ptr_fun(&twice)), 2)));
+  sig.emit(std::string("arg"));
+}
+
+void
+test_accumulated()
+{
+  A a;
+  auto f1 = sigc::ptr_fun<&twice>();
+  auto f2 = sigc::mem_fun<&A::bar>(a);
+  sigc::static_signal<decltype(f1), decltype(f2)>::accumulated<sum_accumulator> sum(f1, f2);
+  result_stream << sum.emit(3) << " ";
+
+  auto f3 = [](int i) { return i; };
+  sigc::static_signal<decltype(f3), decltype(f2)>::accumulated<interruptable_accumulator>
+    interruptable(f3, f2);
+  result_stream << interruptable(0) << " " << interruptable(4) << " ";
+
+  sigc::static_signal<decltype(sigc::ptr_fun<&foo>())>::accumulated<count_accumulator> count(
+    sigc::ptr_fun<&foo>());
+  result_stream << count(5);
+}
+
+void
+test_state()
+{
+  // The functors are stored by value, and they keep their state.
+  int calls = 0;
+  sigc::static_signal sig([calls]() mutable { return ++calls; });
+  sig();
+  result_stream << sig() << " " << sig.get<0>()() << " " << calls << " ";
+
+  sigc::static_signal<> empty;
+  empty.emit(1);
+  result_stream << empty.empty();
+}
+
+void
+test_emit_move()
+{
+  sigc::static_signal sig(
+    [](const std::unique_ptr<int>& p) { result_stream << "observe(" << *p << ") "; },
+    [](std::unique_ptr<int> p) { result_stream << "take(" << *p << ") "; });
+  sig.emit_move(std::make_unique<int>(6));
+
+  auto p = std::make_unique<int>(7);
+  sig.emit_move(std::move(p));
+  result_stream << (p == nullptr);
+}
+
+void
+test_slot()
+{
+  // A static_signal is a functor too.
+  sigc::signal<void(int)> signal;
+  signal.connect(sigc::static_signal(sigc::ptr_fun<&foo>(), sigc::ptr_fun<&foo>()));
+  signal.emit(8);
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_emit();
+  util->check_result(result_stream, "foo(1) A::bar(1) 10 foo(2) A::bar(2) 20");
+
+  test_adaptors();
+  util->check_result(result_stream, "A::baz(arg, 1) A::baz(bound, 0) ");
+
+  test_accumulated();
+  util->check_result(result_stream, "A::bar(3) 10 0 A::bar(4) 1 foo(5) 1");
+
+  test_state();
+  util->check_result(result_stream, "2 3 0 1");
+
+  test_emit_move();
+  util->check_result(result_stream, "observe(6) take(6) observe(7) take(7) 1");
+
+  test_slot();
+  util->check_result(result_stream, "foo(8) foo(8) ");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,116 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/stats.h>
+#include <sigc++/signal.h>
+#include <sigc++/connection.h>
+#include <sigc++/trackable.h>
+#include <sigc++/functors/mem_fun.h>
+#include <sstream>
+#include <cstdlib>
+
+namespace
+{
+std::ostringstream result_stream;
+
+sigc::connection connection_to_disconnect;
+
+class HandlerClass : public sigc::trackable
+{
+public:
+  void handler() { result_stream << "handler "; }
+
+  void disconnecting_handler()
+  {
+    connection_to_disconnect.disconnect();
+
+    // The disconnected slot is not removed until the emission has finished.
+    const auto s = sigc::stats();
+    result_stream << "during emission: " << s.slot_reps.count - slot_reps_before << " ";
+  }
+
+  std::size_t slot_reps_before = 0;
+};
+
+std::size_t
+sum_of_size_classes(const sigc::stats_snapshot& s)
+{
+  std::size_t count = 0;
+  for (const auto& size_class : s.slot_reps_by_size)
+    count += size_class.count;
+  return count;
+}
+
+void
+test_connect_and_disconnect()
+{
+  const auto before = sigc::stats();
+
+  {
+    HandlerClass instance;
+    sigc::signal<void()> signal_test;
+    auto conn = signal_test.connect(sigc::mem_fun(instance, &HandlerClass::handler));
+
+    const auto s = sigc::stats();
+    result_stream << s.signal_impls.count - before.signal_impls.count << " "
+                  << s.slot_reps.count - before.slot_reps.count << " "
+                  << s.self_and_iters.count - before.self_and_iters.count << " "
+                  << s.connections.count - before.connections.count << " "
+                  << (s.slot_reps.bytes > before.slot_reps.bytes) << " "
+                  << (s.trackable_callbacks.count > before.trackable_callbacks.count) << " "
+                  << (sum_of_size_classes(s) == s.slot_reps.count);
+  }
+
+  const auto after = sigc::stats();
+  result_stream << ", " << after.signal_impls.count - before.signal_impls.count << " "
+                << after.slot_reps.count - before.slot_reps.count << " "
+                << after.slot_reps.bytes - before.slot_reps.bytes << " "
+                << after.self_and_iters.count - before.self_and_iters.count << " "
+                << after.connections.count - before.connections.count << " "
+                << after.trackable_callbacks.count - before.trackable_callbacks.count << " "
+                << after.trackable_callback_lists.count - before.trackable_callback_lists.count;
+}
+
+void
+test_deferred_sweep()
+{
+  HandlerClass instance;
+  sigc::signal<void()> signal_test;
+  signal_test.connect(sigc::mem_fun(instance, &HandlerClass::disconnecting_handler));
+  connection_to_disconnect = signal_test.connect(sigc::mem_fun(instance, &HandlerClass::handler));
+
+  instance.slot_reps_before = sigc::stats().slot_reps.count;
+  signal_test.emit();
+  result_stream << "removed after emission: "
+                << instance.slot_reps_before - sigc::stats().slot_reps.count;
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_connect_and_disconnect();
+#ifdef SIGCXX_ENABLE_STATS
+  util->check_result(result_stream, "1 1 1 1 1 1 1, 0 0 0 0 0 0 0");
+#else
+  // Nothing is counted. The empty size classes add up to the zero slot_reps.
+  util->check_result(result_stream, "0 0 0 0 0 0 1, 0 0 0 0 0 0 0");
+#endif
+
+  test_deferred_sweep();
+#ifdef SIGCXX_ENABLE_STATS
+  util->check_result(result_stream, "during emission: 0 removed after emission: 1");
+#else
+  util->check_result(result_stream, "during emission: 0 removed after emission: 0");
+#endif
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,200 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/tracing.h>
+#include <sigc++/signal.h>
+#include <sigc++/functors/ptr_fun.h>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+std::ostringstream result_stream;
+
+sigc::signal<void()> inner;
+
+void
+inner_handler()
+{
+}
+
+void
+outer_handler()
+{
+  inner.emit();
+}
+
+// Returns the value of a string or number field of an event, or "".
+std::string
+field(const std::string& line, const std::string& name)
+{
+  const auto key = "\"" + name + "\":";
+  auto pos = line.find(key);
+  if (pos == std::string::npos)
+    return std::string();
+  pos += key.size();
+  if (line[pos] == '"')
+    return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+  return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+// Writes the recorded events, and returns them as "cat:ph" pairs, without metadata events.
+std::string
+trace_sequence()
+{
+  std::ostringstream json;
+  const auto count = sigc::write_trace_events(json);
+
+  std::istringstream lines(json.str());
+  std::string line;
+  std::string sequence;
+  std::size_t events = 0;
+  while (std::getline(lines, line))
+  {
+    if (line.find("\"ph\":\"B\"") == std::string::npos &&
+        line.find("\"ph\":\"E\"") == std::string::npos)
+      continue;
+    sequence += field(line, "cat") + ":" + field(line, "ph") + " ";
+    ++events;
+  }
+  return std::to_string(count == events) + " " + sequence;
+}
+
+void
+test_nested_emission()
+{
+  sigc::signal<void()> outer;
+  outer.connect(sigc::ptr_fun(&outer_handler));
+  inner.connect(sigc::ptr_fun(&inner_handler));
+
+  outer.emit(); // Not traced.
+  sigc::start_tracing();
+  outer.emit();
+  sigc::stop_tracing();
+  outer.emit(); // Not traced.
+
+  result_stream << trace_sequence();
+  inner.clear();
+}
+
+void
+test_slot_labels()
+{
+  sigc::slot<void()> slot = sigc::ptr_fun(&inner_handler);
+
+  sigc::start_tracing();
+  slot();
+  sigc::stop_tracing();
+
+  std::ostringstream json;
+  sigc::write_trace_events(json);
+  const auto str = json.str();
+  result_stream << (str.find("pointer_functor<void ()>") != std::string::npos) << " "
+                << (str.find("\"signal\":") == std::string::npos) << " "
+                << (str.find("\"dropped_events\":0") != std::string::npos);
+}
+
+void
+test_threads()
+{
+  sigc::signal<void()> signal_test;
+  signal_test.connect(sigc::ptr_fun(&inner_handler));
+
+  sigc::start_tracing();
+  signal_test.emit();
+  std::thread thread([&signal_test]() { signal_test.emit(); });
+  thread.join();
+  sigc::stop_tracing();
+
+  std::ostringstream json;
+  result_stream << sigc::write_trace_events(json) << " ";
+
+  std::istringstream lines(json.str());
+  std::string line;
+  std::string first_tid;
+  bool other_thread = false;
+  while (std::getline(lines, line))
+  {
+    const auto tid = field(line, "tid");
+    if (tid.empty() || field(line, "ph") == "M")
+      continue;
+    if (first_tid.empty())
+      first_tid = tid;
+    else if (tid != first_tid)
+      other_thread = true;
+  }
+  result_stream << other_thread;
+}
+
+void
+test_full_buffer()
+{
+  sigc::signal<void()> signal_test;
+  signal_test.connect(sigc::ptr_fun(&inner_handler));
+
+  // Room for two emissions with one slot each.
+  sigc::start_tracing(8);
+  for (int i = 0; i < 5; ++i)
+    signal_test.emit();
+  sigc::stop_tracing();
+
+  std::ostringstream json;
+  result_stream << sigc::write_trace_events(json) << " "
+                << field(json.str(), "dropped_events");
+  sigc::start_tracing();
+  sigc::stop_tracing();
+}
+
+void
+test_full_buffer_nested()
+{
+  sigc::signal<void()> outer;
+  outer.connect(sigc::ptr_fun(&outer_handler));
+  inner.connect(sigc::ptr_fun(&inner_handler));
+
+  // Room for the outer emission and slot, and their end events.
+  // The nested begin events are dropped, because there's no room for their end events.
+  sigc::start_tracing(4);
+  outer.emit();
+  sigc::stop_tracing();
+
+  result_stream << trace_sequence();
+  inner.clear();
+  sigc::start_tracing();
+  sigc::stop_tracing();
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  auto util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_nested_emission();
+  util->check_result(result_stream,
+    "1 signal:B slot:B signal:B slot:B slot:E signal:E slot:E signal:E ");
+
+  test_slot_labels();
+  util->check_result(result_stream, "1 1 1");
+
+  test_threads();
+  util->check_result(result_stream, "8 1");
+
+  test_full_buffer();
+  util->check_result(result_stream, "8 6");
+
+  test_full_buffer_nested();
+  util->check_result(result_stream, "1 signal:B slot:B slot:E signal:E ");
+
+  // Nothing is left.
+  result_stream << trace_sequence();
+  util->check_result(result_stream, "1 ");
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
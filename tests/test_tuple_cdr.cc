@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <sigc++/tuple-utils/tuple_cdr.h>
 #include <functional>
+#include <string>
 
 void
 test_tuple_type_cdr()
@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <sigc++/tuple-utils/tuple_end.h>
 #include <functional>
+#include <string>
 
 void
 test_tuple_end()
@@ -19,7 +19,128 @@
 #include "testutilities.h"
 
 #include <iostream>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
+#include <new>
+
+namespace
+{
+thread_local std::uint64_t allocations = 0;
+thread_local std::uint64_t allocated_bytes = 0;
+thread_local std::uint64_t freed_bytes = 0;
+
+// Each allocation is preceded by its size, so that operator delete knows it.
+// The header keeps the alignment that malloc() guarantees.
+union allocation_header
+{
+  std::size_t size;
+  std::max_align_t align;
+};
+} // anonymous namespace
+
+// static
+std::uint64_t
+AllocationCounter::total() noexcept
+{
+  return allocations;
+}
+
+// static
+std::uint64_t
+AllocationCounter::total_bytes() noexcept
+{
+  return allocated_bytes;
+}
+
+// static
+std::uint64_t
+AllocationCounter::total_freed_bytes() noexcept
+{
+  return freed_bytes;
+}
+
+// Count all allocations. By default, the other variants of operator new
+// and operator delete, except the aligned ones, call these.
+void*
+operator new(std::size_t size)
+{
+  ++allocations;
+  allocated_bytes += size;
+  if (auto header = static_cast<allocation_header*>(std::malloc(sizeof(allocation_header) + size)))
+  {
+    header->size = size;
+    return header + 1;
+  }
+  throw std::bad_alloc();
+}
+
+void*
+operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+// Older standard libraries implement the nothrow variants with malloc().
+void*
+operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  try
+  {
+    return operator new(size);
+  }
+  catch (const std::bad_alloc&)
+  {
+    return nullptr;
+  }
+}
+
+void*
+operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+  return operator new(size, tag);
+}
+
+void
+operator delete(void* p) noexcept
+{
+  if (!p)
+    return;
+  const auto header = static_cast<allocation_header*>(p) - 1;
+  freed_bytes += header->size;
+  std::free(header);
+}
+
+void
+operator delete[](void* p) noexcept
+{
+  operator delete(p);
+}
+
+// The sized variants must be replaced together with the unsized ones.
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+void
+operator delete[](void* p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+void
+operator delete(void* p, const std::nothrow_t&) noexcept
+{
+  operator delete(p);
+}
+
+void
+operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+  operator delete(p);
+}
 
 TestUtilities* TestUtilities::instance_ = nullptr;
 
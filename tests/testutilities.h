@@ -16,6 +16,7 @@
  * License along with this library. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
 #include <string>
 #include <sstream>
 
@@ -50,3 +51,46 @@ private:
   bool result_ok_;
   int test_number_;
 };
+
+// Counts the calls to the global operator new in the current thread,
+// while an instance exists. testutilities.cc replaces operator new and
+// operator delete, so all programs that use TestUtilities can count allocations.
+class AllocationCounter
+{
+public:
+  AllocationCounter() { reset(); }
+
+  // The number of allocations since the construction, or since the last reset().
+  std::uint64_t count() const { return total() - start_; }
+
+  // The number of bytes that the allocations since the construction, or since
+  // the last reset(), have requested.
+  std::uint64_t bytes() const { return total_bytes() - start_bytes_; }
+
+  // The bytes allocated minus the bytes freed since the construction, or since
+  // the last reset(). Negative if more has been freed than allocated.
+  std::int64_t live_bytes() const
+  {
+    return static_cast<std::int64_t>(total_bytes() - start_bytes_) -
+           static_cast<std::int64_t>(total_freed_bytes() - start_freed_bytes_);
+  }
+
+  void reset()
+  {
+    start_ = total();
+    start_bytes_ = total_bytes();
+    start_freed_bytes_ = total_freed_bytes();
+  }
+
+  // The number of allocations in the current thread since the thread started.
+  static std::uint64_t total() noexcept;
+
+  // The bytes allocated and freed in the current thread since the thread started.
+  static std::uint64_t total_bytes() noexcept;
+  static std::uint64_t total_freed_bytes() noexcept;
+
+private:
+  std::uint64_t start_;
+  std::uint64_t start_bytes_;
+  std::uint64_t start_freed_bytes_;
+};